@@ -0,0 +1,61 @@
+/*
+ * @file AllNearestNeighbors.cpp
+ * @brief Implementation of the AllNearestNeighbors class for finding the nearest neighbor of every point.
+ *
+ * This file contains the implementation of the AllNearestNeighbors class. The queries are issued in the
+ * KdTree's own storage order, so consecutive queries start near each other and revisit the same parts of
+ * the tree. Each worker thread handles a contiguous block of that order.
+ *
+ * @author Phat Tran
+ */
+
+#include "AllNearestNeighbors.h"
+#include "KdTree.h"
+#include "ParallelUtils.h"
+#include <thread>
+
+using namespace std;
+
+/*
+ * @brief Find the nearest neighbor of every point.
+ * @param points The points, such as a PointSet.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @return For each point, the input index of its nearest other point (-1 if the set has fewer than two points).
+ * @pre None.
+ * @post The nearest neighbor index of every point is returned.
+ */
+vector<int> AllNearestNeighbors::findAllNearestNeighbors(const PointSpan &points, int threadCount)
+{
+    vector<int> nearestNeighbors(points.size(), -1);
+    if (points.size() < 2)
+    {
+        return nearestNeighbors;
+    }
+
+    KdTree tree(points);
+    size_t size = tree.size();
+    int workerCount = ParallelUtils::resolveThreadCount(threadCount, size);
+
+    // Each worker answers the queries for one contiguous block of tree positions
+    vector<thread> workers;
+    for (int worker = 0; worker < workerCount; worker++)
+    {
+        size_t begin = size * worker / workerCount;
+        size_t end = size * (worker + 1) / workerCount;
+        workers.push_back(thread([&tree, &nearestNeighbors, begin, end]()
+                                 {
+                                     for (size_t position = begin; position < end; position++)
+                                     {
+                                         double distance;
+                                         int index = tree.getIndex(position);
+                                         nearestNeighbors[index] = tree.findNearest(tree.getX(position), tree.getY(position), index, distance);
+                                     }
+                                 }));
+    }
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    return nearestNeighbors;
+}
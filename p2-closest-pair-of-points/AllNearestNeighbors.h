@@ -0,0 +1,33 @@
+/*
+ * @file AllNearestNeighbors.h
+ * @brief Declaration of the AllNearestNeighbors class for finding the nearest neighbor of every point.
+ *
+ * This file contains the declaration of the AllNearestNeighbors class, which computes, for every point of
+ * a PointSet, the index of the closest other point. The points are indexed once in a KdTree and the
+ * queries are split among worker threads, each writing to a disjoint part of the result array.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include "PointSpan.h"
+#include <vector>
+
+/*
+ * @brief Class representing an algorithm to find the nearest neighbor of every point.
+ */
+class AllNearestNeighbors
+{
+public:
+    /*
+     * @brief Find the nearest neighbor of every point.
+     * @param points The points, such as a PointSet.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @return For each point, the input index of its nearest other point (-1 if the set has fewer than two points).
+     * @pre None.
+     * @post The nearest neighbor index of every point is returned.
+     */
+    static std::vector<int> findAllNearestNeighbors(const PointSpan &points, int threadCount = 0);
+};
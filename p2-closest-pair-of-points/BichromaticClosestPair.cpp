@@ -0,0 +1,94 @@
+/*
+ * @file BichromaticClosestPair.cpp
+ * @brief Implementation of the BichromaticClosestPair class for finding the closest red/blue pair of points.
+ *
+ * This file contains the implementation of the BichromaticClosestPair class. The tree is built over the
+ * larger set so that the O(log m) queries come from the smaller one. Every worker passes its current best
+ * distance to the tree as a bound, so once a close pair is known most of the tree is pruned without being
+ * visited. The per-worker results are combined after the workers finish.
+ *
+ * @author Phat Tran
+ */
+
+#include "BichromaticClosestPair.h"
+#include "KdTree.h"
+#include "ParallelUtils.h"
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/*
+ * @brief Find the closest pair with one point from each set.
+ * @param redPoints The first set of points, such as a PointSet.
+ * @param bluePoints The second set of points, such as a PointSet.
+ * @param redIndex Receives the index of the pair's point in redPoints, or -1 if either set is empty.
+ * @param blueIndex Receives the index of the pair's point in bluePoints, or -1 if either set is empty.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @return The distance between the closest red/blue pair.
+ * @pre Both sets contain at least one point.
+ * @post The closest red/blue pair and its distance are reported.
+ */
+double BichromaticClosestPair::findClosestPair(const PointSpan &redPoints, const PointSpan &bluePoints, int &redIndex, int &blueIndex,
+                                               int threadCount)
+{
+    redIndex = -1;
+    blueIndex = -1;
+    if (redPoints.size() == 0 || bluePoints.size() == 0)
+    {
+        cerr << "Error: The bichromatic closest pair algorithm requires at least one point in each set." << endl;
+        return numeric_limits<double>::max();
+    }
+
+    // Index the larger set and query with the smaller one
+    bool queryRed = redPoints.size() <= bluePoints.size();
+    const PointSpan &queryPoints = queryRed ? redPoints : bluePoints;
+    KdTree tree(queryRed ? bluePoints : redPoints);
+
+    int workerCount = ParallelUtils::resolveThreadCount(threadCount, queryPoints.size());
+    vector<double> bestDistances(workerCount, numeric_limits<double>::max());
+    vector<int> bestQueries(workerCount, -1);
+    vector<int> bestMatches(workerCount, -1);
+
+    // Each worker scans one contiguous block of query points, bounding every search by its best so far
+    vector<thread> workers;
+    for (int worker = 0; worker < workerCount; worker++)
+    {
+        size_t begin = queryPoints.size() * worker / workerCount;
+        size_t end = queryPoints.size() * (worker + 1) / workerCount;
+        workers.push_back(thread([&, worker, begin, end]()
+                                 {
+                                     for (size_t i = begin; i < end; i++)
+                                     {
+                                         double distance;
+                                         int match = tree.findNearest(queryPoints.getX(i), queryPoints.getY(i), -1, distance, bestDistances[worker]);
+                                         if (match >= 0)
+                                         {
+                                             bestDistances[worker] = distance;
+                                             bestQueries[worker] = static_cast<int>(i);
+                                             bestMatches[worker] = match;
+                                         }
+                                     }
+                                 }));
+    }
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    // Combine the per-worker results
+    int bestWorker = 0;
+    for (int worker = 1; worker < workerCount; worker++)
+    {
+        if (bestDistances[worker] < bestDistances[bestWorker])
+        {
+            bestWorker = worker;
+        }
+    }
+    redIndex = queryRed ? bestQueries[bestWorker] : bestMatches[bestWorker];
+    blueIndex = queryRed ? bestMatches[bestWorker] : bestQueries[bestWorker];
+
+    return bestDistances[bestWorker];
+}
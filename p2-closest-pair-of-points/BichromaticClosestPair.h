@@ -0,0 +1,37 @@
+/*
+ * @file BichromaticClosestPair.h
+ * @brief Declaration of the BichromaticClosestPair class for finding the closest red/blue pair of points.
+ *
+ * This file contains the declaration of the BichromaticClosestPair class, which finds the closest pair of
+ * points with one point taken from each of two PointSets. The larger set is indexed in a KdTree and the
+ * points of the smaller set are queried against it in parallel, each worker pruning with the best distance
+ * it has found so far.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include "PointSpan.h"
+
+/*
+ * @brief Class representing an algorithm to find the closest pair between two point sets.
+ */
+class BichromaticClosestPair
+{
+public:
+    /*
+     * @brief Find the closest pair with one point from each set.
+     * @param redPoints The first set of points, such as a PointSet.
+     * @param bluePoints The second set of points, such as a PointSet.
+     * @param redIndex Receives the index of the pair's point in redPoints, or -1 if either set is empty.
+     * @param blueIndex Receives the index of the pair's point in bluePoints, or -1 if either set is empty.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @return The distance between the closest red/blue pair.
+     * @pre Both sets contain at least one point.
+     * @post The closest red/blue pair and its distance are reported.
+     */
+    static double findClosestPair(const PointSpan &redPoints, const PointSpan &bluePoints, int &redIndex, int &blueIndex,
+                                  int threadCount = 0);
+};
@@ -3,33 +3,53 @@
  * @brief Implementation of the ClosestPairAlgorithm class for finding the closest pair of points.
  *
  * This file contains the implementation of the ClosestPairAlgorithm class, which provides functions
- * to find the closest pair of points in a given PointSet. It includes a static function for finding
- * the closest pair distance, private recursive functions for the algorithm, as well as helper
- * functions for brute-force calculation, printing information about the closest pair, and a utility
- * function to find the smaller of two double values.
+ * to find the closest pair of points in a given PointSet. It includes static functions for finding
+ * the closest pair distance, an approximate closest pair distance, the closest pair itself, and the
+ * k closest pairs, an entry point for points that are already sorted, private recursive functions for
+ * the algorithms, as well as helper functions for brute-force calculation, printing information about
+ * the closest pair, and a utility function to find the smaller of two double values.
  *
  * @author Phat Tran
  */
 
 #include "ClosestPairAlgorithm.h"
+#include "SpaceFillingCurve.h"
 #include <algorithm>
 #include <iostream>
 #include <limits>
 #include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <mutex>
 
 using namespace std;
 
+// Relative amount by which the certifying grid's cells exceed the threshold they certify
+const double CELL_SLACK = 1e-9;
+
+// Largest number of cells per axis for the certifying grid, so that cell coordinates fit in a size_t
+const double MAX_GRID_CELLS = 1e18;
+
+// Most points per grid bucket before the certifying grid gives up and the exact algorithm is used
+const int MAX_BUCKET_POINTS = 32;
+
+// Points per brute-force leaf, chosen by calibrateLeafSize, setLeafSize or the first search
+atomic<int> ClosestPairAlgorithm::chosenLeafSize{0};
+once_flag ClosestPairAlgorithm::calibrationFlag;
+
 /*
  * @brief Find the closest pair distance using the divide and conquer algorithm.
- * @param pointSet The set of points to search for the closest pair.
+ * @param points The points to search for the closest pair, such as a PointSet.
  * @return The distance between the closest pair of points.
- * @pre The PointSet object must exist and contain at least two points.
+ * @pre The points must contain at least two points.
  * @post The distance between the closest pair of points is returned.
  */
-double ClosestPairAlgorithm::findClosestPairDistance(const PointSet &pointSet)
+double ClosestPairAlgorithm::findClosestPairDistance(const PointSpan &points)
 {
     // Check if the point set has enough points to find a pair
-    int size = static_cast<int>(pointSet.size());
+    int size = static_cast<int>(points.size());
     if (size < 2)
     {
         // Print an error message and return the maximum possible distance
@@ -37,45 +57,704 @@ double ClosestPairAlgorithm::findClosestPairDistance(const PointSet &pointSet)
         return numeric_limits<double>::max();
     }
 
-    // Sort points by x-coordinate
-    PointSet sortedPointsX = pointSet;
+    // Sort points by x- and y-coordinate
+    PointSet sortedPointsX;
+    PointSet sortedPointsY;
+    presortPoints(points, sortedPointsX, sortedPointsY);
+
+    // Call the recursive function with the entire range of points
+    return findClosestPairRecursive(sortedPointsX, sortedPointsY, 0, size - 1, true).getDistance();
+}
+
+/*
+ * @brief Find an approximate closest pair distance with a certified (1 + epsilon) guarantee.
+ * @param points The points to search for the closest pair, such as a PointSet.
+ * @param epsilon The allowed relative error; 0 asks for the exact distance.
+ * @param lowerBound Receives a certified lower bound on the closest pair distance, at least the result divided by (1 + epsilon).
+ * @return The distance of an actual pair of points, at most (1 + epsilon) times the closest pair distance.
+ * @pre The points must contain at least two points, and epsilon is non-negative.
+ * @post The approximate distance and its certified lower bound are returned.
+ */
+double ClosestPairAlgorithm::findApproximateClosestPairDistance(const PointSpan &points, double epsilon, double &lowerBound)
+{
+    // Check if the point set has enough points to find a pair
+    lowerBound = 0.0;
+    int size = static_cast<int>(points.size());
+    if (size < 2 || epsilon < 0.0)
+    {
+        // Print an error message and return the maximum possible distance
+        cerr << "Error: The approximate closest pair algorithm requires at least two points and a non-negative epsilon." << endl;
+        return numeric_limits<double>::max();
+    }
+
+    // Copy the coordinates once so that the passes below read contiguous arrays
+    vector<double> xs(size), ys(size);
+    double minX = points.getX(0), maxX = minX;
+    double minY = points.getY(0), maxY = minY;
+    for (int i = 0; i < size; i++)
+    {
+        xs[i] = points.getX(i);
+        ys[i] = points.getY(i);
+        minX = min(minX, xs[i]);
+        maxX = max(maxX, xs[i]);
+        minY = min(minY, ys[i]);
+        maxY = max(maxY, ys[i]);
+    }
+
+    // Upper bound: the closest of a few neighbors along a Morton curve. The top 16 bits of each axis are
+    // enough to bring near points together, and halve the radix sort passes.
+    const int CURVE_NEIGHBORS = 3;
+    double upperSquared = numeric_limits<double>::infinity();
+    {
+        vector<uint64_t> keys = SpaceFillingCurve::computeMortonKeys(points);
+        for (uint64_t &key : keys)
+        {
+            key >>= 32;
+        }
+        vector<int> order = SpaceFillingCurve::radixSort(keys);
+        vector<double> curveXs(size), curveYs(size);
+        for (int i = 0; i < size; i++)
+        {
+            curveXs[i] = xs[order[i]];
+            curveYs[i] = ys[order[i]];
+        }
+        xs.swap(curveXs);
+        ys.swap(curveYs);
+        for (int i = 0; i < size; i++)
+        {
+            for (int j = i + 1; j < size && j <= i + CURVE_NEIGHBORS; j++)
+            {
+                double dx = xs[i] - xs[j];
+                double dy = ys[i] - ys[j];
+                upperSquared = getMinimumValue(upperSquared, dx * dx + dy * dy);
+            }
+        }
+    }
+    if (upperSquared == 0.0)
+    {
+        return 0.0;
+    }
+
+    // Certify with one grid of cell side t = U / (1 + epsilon), widened slightly against rounding: every pair
+    // closer than t lies in the 3 x 3 block of cells around either of its points
+    double threshold = sqrt(upperSquared) / (1.0 + epsilon);
+    double cellSize = threshold * (1.0 + CELL_SLACK);
+    if (max(maxX - minX, maxY - minY) / cellSize < MAX_GRID_CELLS)
+    {
+        bool crowded;
+        double foundSquared = searchGrid(xs, ys, minX, minY, cellSize, crowded);
+        if (!crowded && foundSquared < threshold * threshold)
+        {
+            // Every pair closer than t was measured, so the closest one found is exact
+            lowerBound = sqrt(foundSquared);
+            return lowerBound;
+        }
+        if (!crowded)
+        {
+            // No pair is closer than t, and U is at most (1 + epsilon) t
+            lowerBound = threshold;
+            return sqrt(getMinimumValue(upperSquared, foundSquared));
+        }
+    }
+
+    // Fall back to the exact algorithm
+    double distance = findClosestPair(points).getDistance();
+    lowerBound = distance;
+    return distance;
+}
+
+/*
+ * @brief Find the closest pair of points using the divide and conquer algorithm.
+ * @param points The points to search for the closest pair, such as a PointSet; they are read in place and never copied as a whole.
+ * @return The closest pair, identified by the positions of its points in the input.
+ * @pre The points must contain at least two points.
+ * @post The closest pair is returned without printing the per-call distances.
+ */
+PointPair ClosestPairAlgorithm::findClosestPair(const PointSpan &points)
+{
+    // Check if the point set has enough points to find a pair
+    int size = static_cast<int>(points.size());
+    if (size < 2)
+    {
+        // Print an error message and return an empty pair
+        cerr << "Error: The closest pair algorithm requires at least two points for accurate computation." << endl;
+        return PointPair();
+    }
+
+    // Radix sort the input positions by x-coordinate; the search derives the y-order itself
+    vector<uint64_t> keys(size);
+    for (int i = 0; i < size; i++)
+    {
+        keys[i] = toSortableKey(points.getX(i));
+    }
+    vector<int> order = SpaceFillingCurve::radixSort(keys);
+    vector<uint64_t>().swap(keys);
+
+    // Gather the points in x-order into the search's own arrays, tagged with their input positions
+    CoordinateArrays sortedPoints;
+    sortedPoints.xs.resize(size);
+    sortedPoints.ys.resize(size);
+    sortedPoints.ids.swap(order);
+    for (int i = 0; i < size; i++)
+    {
+        sortedPoints.xs[i] = points.getX(sortedPoints.ids[i]);
+        sortedPoints.ys[i] = points.getY(sortedPoints.ids[i]);
+    }
+
+    return findClosestPairFast(sortedPoints, getLeafSize());
+}
+
+/*
+ * @brief Find the k closest pairs of points using the divide and conquer algorithm.
+ * @param points The points to search for the closest pairs, such as a PointSet.
+ * @param k The number of pairs to report.
+ * @return Up to k pairs sorted by increasing distance, identified by their positions in the input.
+ * @pre k is a non-negative integer.
+ * @post The k closest pairs (or every pair, if there are fewer) are returned.
+ */
+vector<PointPair> ClosestPairAlgorithm::findKClosestPairs(const PointSpan &points, int k)
+{
+    vector<PointPair> result;
+
+    // Nothing to report without at least one pair
+    int size = static_cast<int>(points.size());
+    if (size < 2 || k <= 0)
+    {
+        return result;
+    }
+
+    // Sort points by x- and y-coordinate
+    PointSet sortedPointsX;
+    PointSet sortedPointsY;
+    presortPoints(points, sortedPointsX, sortedPointsY);
+
+    // Collect the k closest pairs in a bounded max-heap
+    priority_queue<PointPair> closestPairs;
+    findKClosestPairsRecursive(sortedPointsX, sortedPointsY, 0, size - 1, k, closestPairs);
+
+    // Drain the heap, farthest first, and reverse into increasing order
+    while (!closestPairs.empty())
+    {
+        result.push_back(closestPairs.top());
+        closestPairs.pop();
+    }
+    reverse(result.begin(), result.end());
+
+    return result;
+}
+
+/*
+ * @brief Find the closest pair of points that have already been sorted by x-coordinate, skipping the presorting step.
+ * @param sortedPointsX The points sorted by x-coordinate.
+ * @return The closest pair, identified by the indices stored in the points.
+ * @pre The PointSet holds at least two points, each with a distinct index.
+ * @post The closest pair is returned without printing the per-call distances.
+ */
+PointPair ClosestPairAlgorithm::findClosestPairPresorted(const PointSet &sortedPointsX)
+{
+    // Check if the point set has enough points to find a pair
+    if (sortedPointsX.size() < 2)
+    {
+        // Print an error message and return an empty pair
+        cerr << "Error: The closest pair algorithm requires at least two points for accurate computation." << endl;
+        return PointPair();
+    }
+
+    // Copy the points into separate coordinate arrays for the search
+    int size = static_cast<int>(sortedPointsX.size());
+    CoordinateArrays points;
+    points.xs.resize(size);
+    points.ys.resize(size);
+    points.ids.resize(size);
+    for (int i = 0; i < size; i++)
+    {
+        points.xs[i] = sortedPointsX[i].getX();
+        points.ys[i] = sortedPointsX[i].getY();
+        points.ids[i] = sortedPointsX[i].getIndex();
+    }
+
+    return findClosestPairFast(points, getLeafSize());
+}
+
+/*
+ * @brief Time the closest pair search on a synthetic input for every supported leaf size and keep the fastest.
+ * @return The leaf size chosen, which findClosestPair and findClosestPairPresorted use from now on.
+ * @pre None.
+ * @post The leaf size is set to the fastest candidate on this machine. The first search calibrates on its own
+ *       if neither this function nor setLeafSize has been called.
+ */
+int ClosestPairAlgorithm::calibrateLeafSize()
+{
+    int fastestLeafSize = measureFastestLeafSize();
+    chosenLeafSize.store(fastestLeafSize);
+    return fastestLeafSize;
+}
+
+/*
+ * @brief Set the number of points below which the search switches to brute force.
+ * @param newLeafSize The new leaf size, from MIN_LEAF_SIZE to MAX_LEAF_SIZE.
+ * @pre None.
+ * @post The leaf size is updated, or left unchanged with an error message if it is out of range.
+ */
+void ClosestPairAlgorithm::setLeafSize(int newLeafSize)
+{
+    if (newLeafSize < MIN_LEAF_SIZE || newLeafSize > MAX_LEAF_SIZE)
+    {
+        cerr << "Error: The leaf size must be between " << MIN_LEAF_SIZE << " and " << MAX_LEAF_SIZE << "." << endl;
+        return;
+    }
+    chosenLeafSize.store(newLeafSize);
+}
+
+/*
+ * @brief Get the number of points below which the search switches to brute force.
+ * @return The current leaf size.
+ * @pre None.
+ * @post The leaf size is returned, after calibrating it once if it has not been chosen yet.
+ */
+int ClosestPairAlgorithm::getLeafSize()
+{
+    // Concurrent first searches wait for a single calibration; a size set meanwhile is kept
+    auto calibrate = []()
+    {
+        if (chosenLeafSize.load() == 0)
+        {
+            int unset = 0;
+            chosenLeafSize.compare_exchange_strong(unset, measureFastestLeafSize());
+        }
+    };
+    call_once(calibrationFlag, calibrate);
+    return chosenLeafSize.load();
+}
+
+/*
+ * @brief Find the closest pair of points sorted by x-coordinate with the allocation-free search.
+ * @param points The coordinates and indices of the points, sorted by x-coordinate.
+ * @param leafSize The number of points below which the search switches to brute force.
+ * @return The closest pair, identified by the indices stored with the points.
+ * @pre The arrays hold at least two points, and leafSize is from MIN_LEAF_SIZE to MAX_LEAF_SIZE.
+ * @post The closest pair is returned and the arrays are left sorted by y-coordinate.
+ */
+PointPair ClosestPairAlgorithm::findClosestPairFast(CoordinateArrays &points, int leafSize)
+{
+    // One scratch buffer serves the whole search
+    int size = static_cast<int>(points.xs.size());
+    CoordinateArrays scratch = points;
+
+    double bestSquaredDistance = numeric_limits<double>::infinity();
+    int bestFirstIndex = -1;
+    int bestSecondIndex = -1;
+    findClosestPairFastRecursive(points, scratch, 0, size - 1, bestSquaredDistance, bestFirstIndex, bestSecondIndex, leafSize);
+
+    return PointPair(bestFirstIndex, bestSecondIndex, sqrt(bestSquaredDistance));
+}
+
+/*
+ * @brief Time the closest pair search on a synthetic input for every supported leaf size.
+ * @return The fastest leaf size on this machine.
+ * @pre None.
+ * @post The chosen leaf size is left unchanged.
+ */
+int ClosestPairAlgorithm::measureFastestLeafSize()
+{
+    // A fixed pseudo-random input, large enough to reach many leaves, sorted once up front
+    const int CALIBRATION_POINTS = 1 << 15;
+    const int CALIBRATION_ROUNDS = 3;
+    const int CANDIDATES[] = {4, 8, 16, 24, 32, 48, 64};
+
+    mt19937 generator(12345);
+    uniform_real_distribution<double> coordinate(0.0, 1.0);
+    PointSet sortedPointsX;
+    for (int i = 0; i < CALIBRATION_POINTS; i++)
+    {
+        sortedPointsX.addPoint(Point(coordinate(generator), coordinate(generator), i));
+    }
     sort(sortedPointsX.begin(), sortedPointsX.end(), Point::compareX);
+    CoordinateArrays sortedPoints;
+    for (const Point &point : sortedPointsX)
+    {
+        sortedPoints.xs.push_back(point.getX());
+        sortedPoints.ys.push_back(point.getY());
+        sortedPoints.ids.push_back(point.getIndex());
+    }
+
+    // Keep the best of several rounds for each candidate to filter out noise; the search re-sorts its input, so
+    // every round starts from a fresh copy
+    int fastestLeafSize = CANDIDATES[0];
+    double bestTime = numeric_limits<double>::max();
+    for (int candidate : CANDIDATES)
+    {
+        for (int round = 0; round < CALIBRATION_ROUNDS; round++)
+        {
+            CoordinateArrays points = sortedPoints;
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            findClosestPairFast(points, candidate);
+            double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (elapsed < bestTime)
+            {
+                bestTime = elapsed;
+                fastestLeafSize = candidate;
+            }
+        }
+    }
+
+    return fastestLeafSize;
+}
+
+/*
+ * @brief Map a coordinate to an unsigned key with the same order, for the radix sort.
+ * @param value The coordinate, which must not be NaN.
+ * @return The key; keys compare like the coordinates they come from.
+ * @pre None.
+ * @post None.
+ */
+uint64_t ClosestPairAlgorithm::toSortableKey(double value)
+{
+    // Flip every bit of a negative value and only the sign bit of a non-negative one
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits >> 63) ? ~bits : (bits | (1ULL << 63));
+}
+
+/*
+ * @brief Recursive allocation-free search, which leaves its range sorted by y-coordinate.
+ * @param points The points; the range is sorted by x-coordinate on entry and by y-coordinate on exit.
+ * @param scratch Buffer of the same size as points, used for merging and for the strip.
+ * @param leftIndex Index of the leftmost point.
+ * @param rightIndex Index of the rightmost point.
+ * @param bestSquaredDistance The squared distance of the closest pair found so far.
+ * @param bestFirstIndex The index of the first point of the closest pair found so far.
+ * @param bestSecondIndex The index of the second point of the closest pair found so far.
+ * @param leafSize The number of points below which the search switches to brute force.
+ * @pre The range holds at least one point.
+ * @post The best pair accounts for every pair in the range.
+ */
+void ClosestPairAlgorithm::findClosestPairFastRecursive(CoordinateArrays &points, CoordinateArrays &scratch, int leftIndex, int rightIndex,
+                                                        double &bestSquaredDistance, int &bestFirstIndex, int &bestSecondIndex, int leafSize)
+{
+    // Base case: Compare every pair of a small range at once
+    if (rightIndex - leftIndex < leafSize)
+    {
+        bruteForceLeaf(points, leftIndex, rightIndex, bestSquaredDistance, bestFirstIndex, bestSecondIndex);
+        return;
+    }
+
+    // Split the range into two halves, remembering the dividing line before the halves are re-sorted
+    int mid = (leftIndex + rightIndex) / 2;
+    double midX = points.xs[mid];
+    findClosestPairFastRecursive(points, scratch, leftIndex, mid, bestSquaredDistance, bestFirstIndex, bestSecondIndex, leafSize);
+    findClosestPairFastRecursive(points, scratch, mid + 1, rightIndex, bestSquaredDistance, bestFirstIndex, bestSecondIndex, leafSize);
+
+    // Merge the two halves back into y-order through the scratch buffer
+    int i = leftIndex, j = mid + 1, target = leftIndex;
+    while (i <= mid || j <= rightIndex)
+    {
+        int source = (j > rightIndex || (i <= mid && points.ys[i] <= points.ys[j])) ? i++ : j++;
+        scratch.xs[target] = points.xs[source];
+        scratch.ys[target] = points.ys[source];
+        scratch.ids[target] = points.ids[source];
+        target++;
+    }
+    copy(scratch.xs.begin() + leftIndex, scratch.xs.begin() + rightIndex + 1, points.xs.begin() + leftIndex);
+    copy(scratch.ys.begin() + leftIndex, scratch.ys.begin() + rightIndex + 1, points.ys.begin() + leftIndex);
+    copy(scratch.ids.begin() + leftIndex, scratch.ids.begin() + rightIndex + 1, points.ids.begin() + leftIndex);
+
+    // Collect the strip around the dividing line into the scratch buffer, in y-order
+    double minDistance = sqrt(bestSquaredDistance);
+    int stripEnd = leftIndex;
+    for (int k = leftIndex; k <= rightIndex; k++)
+    {
+        if (abs(points.xs[k] - midX) < minDistance)
+        {
+            scratch.xs[stripEnd] = points.xs[k];
+            scratch.ys[stripEnd] = points.ys[k];
+            scratch.ids[stripEnd] = points.ids[k];
+            stripEnd++;
+        }
+    }
+
+    // Check for closer pairs in the strip
+    for (int a = leftIndex; a < stripEnd; a++)
+    {
+        for (int b = a + 1; b < stripEnd && scratch.ys[b] - scratch.ys[a] < minDistance; b++)
+        {
+            double dx = scratch.xs[a] - scratch.xs[b];
+            double dy = scratch.ys[a] - scratch.ys[b];
+            double squaredDistance = dx * dx + dy * dy;
+            if (squaredDistance < bestSquaredDistance)
+            {
+                bestSquaredDistance = squaredDistance;
+                bestFirstIndex = scratch.ids[a];
+                bestSecondIndex = scratch.ids[b];
+                minDistance = sqrt(squaredDistance);
+            }
+        }
+    }
+}
+
+/*
+ * @brief Compare every pair of a leaf, then sort the leaf by y-coordinate.
+ * @param points The points.
+ * @param leftIndex Index of the leftmost point of the leaf.
+ * @param rightIndex Index of the rightmost point of the leaf.
+ * @param bestSquaredDistance The squared distance of the closest pair found so far.
+ * @param bestFirstIndex The index of the first point of the closest pair found so far.
+ * @param bestSecondIndex The index of the second point of the closest pair found so far.
+ * @pre The leaf holds at most MAX_LEAF_SIZE points.
+ * @post The best pair accounts for every pair in the leaf, and the leaf is sorted by y-coordinate.
+ */
+void ClosestPairAlgorithm::bruteForceLeaf(CoordinateArrays &points, int leftIndex, int rightIndex,
+                                          double &bestSquaredDistance, int &bestFirstIndex, int &bestSecondIndex)
+{
+    // Gather the leaf into aligned lanes, padded with far-away points so that every row spans whole lane groups
+    const int LANES = 4;
+    alignas(32) double leafXs[MAX_LEAF_SIZE + LANES];
+    alignas(32) double leafYs[MAX_LEAF_SIZE + LANES];
+    int count = rightIndex - leftIndex + 1;
+    for (int k = 0; k < count; k++)
+    {
+        leafXs[k] = points.xs[leftIndex + k];
+        leafYs[k] = points.ys[leftIndex + k];
+    }
+    for (int k = count; k < count + LANES; k++)
+    {
+        leafXs[k] = numeric_limits<double>::infinity();
+        leafYs[k] = numeric_limits<double>::infinity();
+    }
+
+    // Keep one running minimum per lane together with the pair that reached it. The loop has no branches, so the
+    // compiler can vectorize it, and the pair is never located by recomputing its distance, which could round
+    // differently once the compiler fuses the multiply and add in one loop but not the other.
+    double laneMinimum[LANES];
+    int laneFirst[LANES], laneSecond[LANES];
+    for (int lane = 0; lane < LANES; lane++)
+    {
+        laneMinimum[lane] = numeric_limits<double>::infinity();
+        laneFirst[lane] = 0;
+        laneSecond[lane] = 0;
+    }
+    for (int a = 0; a < count - 1; a++)
+    {
+        double x = leafXs[a];
+        double y = leafYs[a];
+        for (int b = a + 1; b < count; b += LANES)
+        {
+            for (int lane = 0; lane < LANES; lane++)
+            {
+                double dx = leafXs[b + lane] - x;
+                double dy = leafYs[b + lane] - y;
+                double squaredDistance = dx * dx + dy * dy;
+                bool closer = squaredDistance < laneMinimum[lane];
+                laneMinimum[lane] = closer ? squaredDistance : laneMinimum[lane];
+                laneFirst[lane] = closer ? a : laneFirst[lane];
+                laneSecond[lane] = closer ? b + lane : laneSecond[lane];
+            }
+        }
+    }
+    int bestLane = 0;
+    for (int lane = 1; lane < LANES; lane++)
+    {
+        bestLane = (laneMinimum[lane] < laneMinimum[bestLane]) ? lane : bestLane;
+    }
+
+    // Padding lanes stay at infinity, so an improvement always names two points of the leaf
+    if (laneMinimum[bestLane] < bestSquaredDistance)
+    {
+        bestSquaredDistance = laneMinimum[bestLane];
+        bestFirstIndex = points.ids[leftIndex + laneFirst[bestLane]];
+        bestSecondIndex = points.ids[leftIndex + laneSecond[bestLane]];
+    }
 
-    // Sort points by y-coordinate
-    PointSet sortedPointsY = pointSet;
-    sort(sortedPointsY.begin(), sortedPointsY.end(), Point::compareY);
+    // Insertion sort the leaf by y-coordinate for the caller's merge
+    for (int a = leftIndex + 1; a <= rightIndex; a++)
+    {
+        double x = points.xs[a];
+        double y = points.ys[a];
+        int id = points.ids[a];
+        int b = a - 1;
+        while (b >= leftIndex && points.ys[b] > y)
+        {
+            points.xs[b + 1] = points.xs[b];
+            points.ys[b + 1] = points.ys[b];
+            points.ids[b + 1] = points.ids[b];
+            b--;
+        }
+        points.xs[b + 1] = x;
+        points.ys[b + 1] = y;
+        points.ids[b + 1] = id;
+    }
+}
+
+/*
+ * @brief Bucket the points into a hashed grid and measure the pairs of neighboring cells.
+ * @param xs The x-coordinates of the points.
+ * @param ys The y-coordinates of the points.
+ * @param minX The smallest x-coordinate of the points.
+ * @param minY The smallest y-coordinate of the points.
+ * @param cellSize The side of a grid cell.
+ * @param crowded Receives whether some bucket holds more than MAX_BUCKET_POINTS points, in which case the search stops.
+ * @return Unless crowded, the smallest squared distance among pairs that include every pair in the same or adjacent cells.
+ * @pre cellSize is positive and every point is fewer than MAX_GRID_CELLS cells from the minimum on both axes.
+ * @post No side effects on the points.
+ */
+double ClosestPairAlgorithm::searchGrid(const vector<double> &xs, const vector<double> &ys, double minX, double minY, double cellSize, bool &crowded)
+{
+    // Hash cell (column, row) to (column + row * stride) modulo a power of two at least twice the number of
+    // points. A neighboring cell is then a fixed offset away in every bucket, and with an odd stride that is
+    // not close to a power of two, no common line direction folds onto a few buckets.
+    int size = static_cast<int>(xs.size());
+    int bucketBits = 1;
+    while ((static_cast<size_t>(1) << bucketBits) < 2 * static_cast<size_t>(size))
+    {
+        bucketBits++;
+    }
+    size_t bucketMask = (static_cast<size_t>(1) << bucketBits) - 1;
+    size_t stride = static_cast<size_t>(sqrt(static_cast<double>(bucketMask + 1)) * 1.618) | 3;
 
-    // Set indices for each point in the sorted order
+    // Counting sort the points by bucket
+    vector<uint32_t> buckets(size);
+    vector<int> starts(bucketMask + 2, 0);
+    for (int i = 0; i < size; i++)
+    {
+        size_t column = static_cast<size_t>((xs[i] - minX) / cellSize);
+        size_t row = static_cast<size_t>((ys[i] - minY) / cellSize);
+        buckets[i] = static_cast<uint32_t>((column + row * stride) & bucketMask);
+        starts[buckets[i] + 1]++;
+    }
+    crowded = false;
+    for (size_t bucket = 1; bucket < starts.size(); bucket++)
+    {
+        crowded = crowded || starts[bucket] > MAX_BUCKET_POINTS;
+        starts[bucket] += starts[bucket - 1];
+    }
+    if (crowded)
+    {
+        return numeric_limits<double>::infinity();
+    }
+    vector<int> positions(starts.begin(), starts.end() - 1);
+    vector<double> bucketXs(size), bucketYs(size);
     for (int i = 0; i < size; i++)
     {
-        sortedPointsX[i].setIndex(i);
-        sortedPointsY[i].setIndex(i);
+        int target = positions[buckets[i]]++;
+        bucketXs[target] = xs[i];
+        bucketYs[target] = ys[i];
     }
 
-    // Call the recursive function with the entire range of points
-    return findClosestPairRecursive(sortedPointsX, sortedPointsY, 0, size - 1);
+    // Compare the points of each bucket with each other and with the buckets of four neighboring cells, so
+    // that every pair of the same or adjacent cells is measured
+    const size_t NEIGHBOR_OFFSETS[] = {1, stride - 1, stride, stride + 1};
+    double bestSquared = numeric_limits<double>::infinity();
+    for (size_t bucket = 0; bucket <= bucketMask; bucket++)
+    {
+        for (int i = starts[bucket]; i < starts[bucket + 1]; i++)
+        {
+            for (int j = i + 1; j < starts[bucket + 1]; j++)
+            {
+                double dx = bucketXs[i] - bucketXs[j];
+                double dy = bucketYs[i] - bucketYs[j];
+                bestSquared = getMinimumValue(bestSquared, dx * dx + dy * dy);
+            }
+            for (size_t offset : NEIGHBOR_OFFSETS)
+            {
+                // A small table can wrap a neighbor onto the bucket itself, whose pairs were measured above
+                size_t other = (bucket + offset) & bucketMask;
+                for (int j = starts[other]; other != bucket && j < starts[other + 1]; j++)
+                {
+                    double dx = bucketXs[i] - bucketXs[j];
+                    double dy = bucketYs[i] - bucketYs[j];
+                    bestSquared = getMinimumValue(bestSquared, dx * dx + dy * dy);
+                }
+            }
+        }
+    }
+    return bestSquared;
+}
+
+/*
+ * @brief Sort a copy of the points by x- and y-coordinate, tagging each point with its input position.
+ * @param points The points to sort.
+ * @param sortedPointsX The PointSet to receive the points sorted by x-coordinate (ties broken by y, then input position).
+ * @param sortedPointsY The PointSet to receive the points sorted by y-coordinate.
+ * @pre None.
+ * @post Both output PointSets hold every input point, with the index set to its input position.
+ */
+void ClosestPairAlgorithm::presortPoints(const PointSpan &points, PointSet &sortedPointsX, PointSet &sortedPointsY)
+{
+    // Tag each point with its input position so results can be reported against the input
+    sortedPointsY = PointSet();
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        sortedPointsY.addPoint(Point(points.getX(i), points.getY(i), static_cast<int>(i)));
+    }
+
+    // Stable sort by y-coordinate so that points sharing a y-coordinate stay in input order
+    stable_sort(sortedPointsY.begin(), sortedPointsY.end(), Point::compareY);
+
+    // Stable sort by x-coordinate so that points sharing an x-coordinate stay ordered by y, then input order
+    sortedPointsX = sortedPointsY;
+    stable_sort(sortedPointsX.begin(), sortedPointsX.end(), Point::compareX);
 }
 
 /*
- * @brief Recursive function to find the closest pair distance using the divide and conquer algorithm.
+ * @brief Split the points of a subproblem, sorted by y-coordinate, into its left and right halves.
+ * @param sortedPointsY The PointSet containing the points of the subproblem sorted by y-coordinate.
+ * @param midPoint The last point of the left half in x-order.
+ * @param leftSortedPointsY The PointSet to receive the left half, sorted by y-coordinate.
+ * @param rightSortedPointsY The PointSet to receive the right half, sorted by y-coordinate.
+ * @param isLeft Receives, for every point of sortedPointsY, whether it was placed in the left half.
+ * @pre sortedPointsY holds exactly the points of the subproblem.
+ * @post The two halves are filled in y-order, consistent with the x-order split at midPoint.
+ */
+void ClosestPairAlgorithm::splitByMidPoint(const PointSet &sortedPointsY, const Point &midPoint,
+                                           PointSet &leftSortedPointsY, PointSet &rightSortedPointsY, vector<bool> &isLeft)
+{
+    isLeft.assign(sortedPointsY.size(), false);
+
+    // Populate points based on the y-coordinate
+    for (int i = 0; i < static_cast<int>(sortedPointsY.size()); i++)
+    {
+        // Compare in the same (x, y, input position) order used to sort by x-coordinate
+        const Point &point = sortedPointsY[i];
+        if ((point.getX() < midPoint.getX()) ||
+            (point.getX() == midPoint.getX() && point.getY() < midPoint.getY()) ||
+            (point.getX() == midPoint.getX() && point.getY() == midPoint.getY() && point.getIndex() <= midPoint.getIndex()))
+        {
+            // Point is on the left side
+            leftSortedPointsY.addPoint(point);
+            isLeft[i] = true;
+        }
+        else
+        {
+            // Point is on the right side
+            rightSortedPointsY.addPoint(point);
+        }
+    }
+}
+
+/*
+ * @brief Recursive function to find the closest pair using the divide and conquer algorithm.
  * @param sortedPointsX The PointSet containing the points sorted by x-coordinate.
  * @param sortedPointsY The PointSet containing the points sorted by y-coordinate.
  * @param leftIndex Index of the leftmost point.
  * @param rightIndex Index of the rightmost point.
- * @return The distance between the closest pair of points in the specified range.
+ * @param printTrace Whether to print the distance found by every recursive call.
+ * @return The closest pair of points in the specified range.
  * @pre The PointSet objects must not be empty.
- * @post The distance between the closest pair of points in the specified range is returned.
+ * @post The closest pair of points in the specified range is returned.
  */
-double ClosestPairAlgorithm::findClosestPairRecursive(const PointSet &sortedPointsX, const PointSet &sortedPointsY, int leftIndex, int rightIndex)
+PointPair ClosestPairAlgorithm::findClosestPairRecursive(const PointSet &sortedPointsX, const PointSet &sortedPointsY, int leftIndex, int rightIndex, bool printTrace)
 {
     // Base case: Use brute force for subarrays with three or fewer points
     if (rightIndex - leftIndex <= 2)
     {
-        double minDistance = bruteForceClosestPairDistance(sortedPointsX, leftIndex, rightIndex);
+        PointPair closestPair = bruteForceClosestPair(sortedPointsX, leftIndex, rightIndex);
 
         // Print the minimum distance with corresponding indices and return it
-        printMinDistance(minDistance, leftIndex, rightIndex);
-        return minDistance;
+        if (printTrace)
+        {
+            printMinDistance(closestPair.getDistance(), leftIndex, rightIndex);
+        }
+        return closestPair;
     }
 
     // Split the subarray into two halves
@@ -85,40 +764,20 @@ double ClosestPairAlgorithm::findClosestPairRecursive(const PointSet &sortedPoin
     // Create sets for points on the left and right of the dividing line, sorted by y-coordinate
     PointSet leftSortedPointsY;
     PointSet rightSortedPointsY;
-    int leftIndexY = 0;
-    int rightIndexY = 0;
+    vector<bool> isLeft;
+    splitByMidPoint(sortedPointsY, midPoint, leftSortedPointsY, rightSortedPointsY, isLeft);
 
-    // Populate points based on the y-coordinate
-    for (int i = 0; i <= (rightIndex - leftIndex) && i < sortedPointsY.size(); i++)
-    {
-        if (((sortedPointsY[i].getX() < midPoint.getX()) ||
-             (sortedPointsY[i].getX() == midPoint.getX() && sortedPointsY[i].getY() <= midPoint.getY())) &&
-            (leftIndexY < mid))
-        {
-            // Point is on the left side
-            leftSortedPointsY.addPoint(sortedPointsY[i]);
-            leftSortedPointsY[leftIndexY].setIndex(leftIndexY);
-            leftIndexY++;
-        }
-        else
-        {
-            // Point is on the right side
-            rightSortedPointsY.addPoint(sortedPointsY[i]);
-            rightSortedPointsY[rightIndexY].setIndex(rightIndexY);
-            rightIndexY++;
-        }
-    }
-
-    // Recursively find the closest pair distance in the left and right halves
-    double leftDistance = findClosestPairRecursive(sortedPointsX, leftSortedPointsY, leftIndex, mid);
-    double rightDistance = findClosestPairRecursive(sortedPointsX, rightSortedPointsY, mid + 1, rightIndex);
+    // Recursively find the closest pair in the left and right halves
+    PointPair leftPair = findClosestPairRecursive(sortedPointsX, leftSortedPointsY, leftIndex, mid, printTrace);
+    PointPair rightPair = findClosestPairRecursive(sortedPointsX, rightSortedPointsY, mid + 1, rightIndex, printTrace);
 
-    // Find the minimum distance among the two halves
-    double minDistance = getMinimumValue(leftDistance, rightDistance);
+    // Find the closest pair among the two halves
+    PointPair closestPair = getCloserPair(leftPair, rightPair);
+    double minDistance = closestPair.getDistance();
 
     // Merge the two halves and find the minimum distance in the strip
     PointSet strip;
-    for (int i = 0; (i < rightIndex - leftIndex + 1) && (i < sortedPointsY.size()); i++)
+    for (int i = 0; i < static_cast<int>(sortedPointsY.size()); i++)
     {
         // Add the point is within the strip of width 2 * minDistance around the mid point
         if (abs(sortedPointsY[i].getX() - midPoint.getX()) < minDistance)
@@ -128,45 +787,161 @@ double ClosestPairAlgorithm::findClosestPairRecursive(const PointSet &sortedPoin
     }
 
     // Check for closer pairs in the strip
-    for (int i = 0; i < strip.size(); i++)
+    for (int i = 0; i < static_cast<int>(strip.size()); i++)
     {
         // Loop through points within minDistance in y-coordinate from the current point
-        for (int j = i + 1; (j < strip.size()) && (strip[j].getY() - strip[i].getY() < minDistance); j++)
+        for (int j = i + 1; (j < static_cast<int>(strip.size())) && (strip[j].getY() - strip[i].getY() < minDistance); j++)
         {
             double distance = Point::calculateDistance(strip[i], strip[j]);
-            minDistance = getMinimumValue(distance, minDistance);
+            if (distance < minDistance)
+            {
+                closestPair = PointPair(strip[i].getIndex(), strip[j].getIndex(), distance);
+                minDistance = distance;
+            }
         }
     }
 
     // Print the minimum distance with corresponding indices and return it
-    printMinDistance(minDistance, leftIndex, rightIndex);
-    return minDistance;
+    if (printTrace)
+    {
+        printMinDistance(minDistance, leftIndex, rightIndex);
+    }
+    return closestPair;
 }
 
 /*
- * @brief Calculate the closest pair distance using a brute-force method.
+ * @brief Recursive function to collect the k closest pairs using the divide and conquer algorithm.
+ * @param sortedPointsX The PointSet containing the points sorted by x-coordinate.
+ * @param sortedPointsY The PointSet containing the points sorted by y-coordinate.
+ * @param leftIndex Index of the leftmost point.
+ * @param rightIndex Index of the rightmost point.
+ * @param k The number of pairs to keep.
+ * @param closestPairs Bounded max-heap holding the k closest pairs found so far.
+ * @pre The PointSet objects must not be empty and k is positive.
+ * @post Every pair in the specified range closer than the current k-th distance has been offered to the heap.
+ */
+void ClosestPairAlgorithm::findKClosestPairsRecursive(const PointSet &sortedPointsX, const PointSet &sortedPointsY, int leftIndex, int rightIndex,
+                                                      int k, priority_queue<PointPair> &closestPairs)
+{
+    // Base case: Offer every pair of a subarray with three or fewer points
+    if (rightIndex - leftIndex <= 2)
+    {
+        for (int i = leftIndex; i <= rightIndex; i++)
+        {
+            for (int j = i + 1; j <= rightIndex; j++)
+            {
+                offerPair(closestPairs, k, sortedPointsX[i], sortedPointsX[j]);
+            }
+        }
+        return;
+    }
+
+    // Split the subarray into two halves
+    int mid = (leftIndex + rightIndex) / 2;
+    Point midPoint = sortedPointsX[mid];
+
+    PointSet leftSortedPointsY;
+    PointSet rightSortedPointsY;
+    vector<bool> isLeft;
+    splitByMidPoint(sortedPointsY, midPoint, leftSortedPointsY, rightSortedPointsY, isLeft);
+
+    // Pairs within each half are handled by the recursive calls
+    findKClosestPairsRecursive(sortedPointsX, leftSortedPointsY, leftIndex, mid, k, closestPairs);
+    findKClosestPairsRecursive(sortedPointsX, rightSortedPointsY, mid + 1, rightIndex, k, closestPairs);
+
+    // The strip only needs to be as wide as the current k-th distance
+    double kthDistance = getKthDistance(closestPairs, k);
+    PointSet strip;
+    vector<bool> stripIsLeft;
+    for (int i = 0; i < static_cast<int>(sortedPointsY.size()); i++)
+    {
+        if (abs(sortedPointsY[i].getX() - midPoint.getX()) < kthDistance)
+        {
+            strip.addPoint(sortedPointsY[i]);
+            stripIsLeft.push_back(isLeft[i]);
+        }
+    }
+
+    // Offer pairs crossing the dividing line, shrinking the window as the k-th distance decreases
+    for (int i = 0; i < static_cast<int>(strip.size()); i++)
+    {
+        for (int j = i + 1; (j < static_cast<int>(strip.size())) && (strip[j].getY() - strip[i].getY() < getKthDistance(closestPairs, k)); j++)
+        {
+            if (stripIsLeft[i] != stripIsLeft[j])
+            {
+                offerPair(closestPairs, k, strip[i], strip[j]);
+            }
+        }
+    }
+}
+
+/*
+ * @brief Calculate the closest pair using a brute-force method.
  * @param points The PointSet containing the points.
  * @param leftIndex Index of the leftmost point.
  * @param rightIndex Index of the rightmost point.
- * @return The distance between the closest pair of points in the specified range.
+ * @return The closest pair of points in the specified range.
  * @pre The PointSet object must not be empty.
- * @post The distance between the closest pair of points in the specified range is returned.
+ * @post The closest pair of points in the specified range is returned.
  */
-double ClosestPairAlgorithm::bruteForceClosestPairDistance(const PointSet &points, int leftIndex, int rightIndex)
+PointPair ClosestPairAlgorithm::bruteForceClosestPair(const PointSet &points, int leftIndex, int rightIndex)
 {
-    // Initialize the minimum distance to the maximum possible value
-    double minDistance = numeric_limits<double>::max();
+    // Initialize the closest pair with the maximum possible distance
+    PointPair closestPair;
 
     for (int i = leftIndex; i <= rightIndex; i++)
     {
         for (int j = i + 1; j <= rightIndex; j++)
         {
             double distance = Point::calculateDistance(points[i], points[j]);
-            minDistance = getMinimumValue(distance, minDistance);
+            if (distance < closestPair.getDistance())
+            {
+                closestPair = PointPair(points[i].getIndex(), points[j].getIndex(), distance);
+            }
         }
     }
 
-    return minDistance;
+    return closestPair;
+}
+
+/*
+ * @brief Offer a pair to a bounded max-heap of the k closest pairs.
+ * @param closestPairs The heap holding at most k pairs, farthest on top.
+ * @param k The maximum number of pairs to keep.
+ * @param a The first point of the pair.
+ * @param b The second point of the pair.
+ * @pre k is positive.
+ * @post The pair is kept if the heap has room or it is closer than the current k-th pair.
+ */
+void ClosestPairAlgorithm::offerPair(priority_queue<PointPair> &closestPairs, int k, const Point &a, const Point &b)
+{
+    double distance = Point::calculateDistance(a, b);
+    if (static_cast<int>(closestPairs.size()) < k)
+    {
+        closestPairs.push(PointPair(a.getIndex(), b.getIndex(), distance));
+    }
+    else if (distance < closestPairs.top().getDistance())
+    {
+        closestPairs.pop();
+        closestPairs.push(PointPair(a.getIndex(), b.getIndex(), distance));
+    }
+}
+
+/*
+ * @brief Get the current k-th smallest distance bound of a bounded max-heap.
+ * @param closestPairs The heap holding at most k pairs, farthest on top.
+ * @param k The maximum number of pairs to keep.
+ * @return The distance of the farthest kept pair, or the maximum possible distance while the heap has room.
+ * @pre k is positive.
+ * @post No side effects on the heap.
+ */
+double ClosestPairAlgorithm::getKthDistance(const priority_queue<PointPair> &closestPairs, int k)
+{
+    if (static_cast<int>(closestPairs.size()) < k)
+    {
+        return numeric_limits<double>::max();
+    }
+    return closestPairs.top().getDistance();
 }
 
 /*
@@ -193,4 +968,17 @@ void ClosestPairAlgorithm::printMinDistance(double minDistance, int leftPointInd
 double ClosestPairAlgorithm::getMinimumValue(double firstValue, double secondValue)
 {
     return (firstValue < secondValue) ? firstValue : secondValue;
-}
\ No newline at end of file
+}
+
+/*
+ * @brief Returns the closer of two pairs.
+ * @param firstPair The first pair.
+ * @param secondPair The second pair.
+ * @return The pair with the smaller distance, preferring the first on ties.
+ * @pre Both pairs are valid PointPair objects.
+ * @post The closer pair is returned.
+ */
+PointPair ClosestPairAlgorithm::getCloserPair(const PointPair &firstPair, const PointPair &secondPair)
+{
+    return (secondPair < firstPair) ? secondPair : firstPair;
+}
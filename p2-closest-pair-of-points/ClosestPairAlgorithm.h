@@ -3,10 +3,11 @@
  * @brief Declaration of the ClosestPairAlgorithm class for finding the closest pair of points.
  *
  * This file contains the declaration of the ClosestPairAlgorithm class, which provides functions
- * to find the closest pair of points in a given PointSet. It includes a static function for finding
- * the closest pair distance, private recursive functions for the algorithm, as well as helper
- * functions for brute-force calculation, printing information about the closest pair, and a utility
- * function to find the smaller of two double values.
+ * to find the closest pair of points in a given PointSet. It includes static functions for finding
+ * the closest pair distance, an approximate closest pair distance, the closest pair itself, and the
+ * k closest pairs, an entry point for points that are already sorted, private recursive functions for
+ * the algorithms, as well as helper functions for brute-force calculation, printing information about
+ * the closest pair, and a utility function to find the smaller of two double values.
  *
  * @author Phat Tran
  */
@@ -14,6 +15,13 @@
 #pragma once
 
 #include "PointSet.h"
+#include "PointPair.h"
+#include "PointSpan.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <queue>
 
 /*
  * @brief Class representing an algorithm to find the closest pair of points.
@@ -23,36 +31,244 @@ class ClosestPairAlgorithm
 public:
     /*
      * @brief Find the closest pair distance using the divide and conquer algorithm.
-     * @param pointSet The set of points to search for the closest pair.
+     * @param points The points to search for the closest pair, such as a PointSet.
      * @return The distance between the closest pair of points.
-     * @pre The PointSet object must exist and contain at least two points.
+     * @pre The points must contain at least two points.
      * @post The distance between the closest pair of points is returned.
      */
-    static double findClosestPairDistance(const PointSet &pointSet);
+    static double findClosestPairDistance(const PointSpan &points);
+
+    /*
+     * @brief Find an approximate closest pair distance with a certified (1 + epsilon) guarantee.
+     * @param points The points to search for the closest pair, such as a PointSet.
+     * @param epsilon The allowed relative error; 0 asks for the exact distance.
+     * @param lowerBound Receives a certified lower bound on the closest pair distance, at least the result divided by (1 + epsilon).
+     * @return The distance of an actual pair of points, at most (1 + epsilon) times the closest pair distance.
+     * @pre The points must contain at least two points, and epsilon is non-negative.
+     * @post The approximate distance and its certified lower bound are returned.
+     */
+    static double findApproximateClosestPairDistance(const PointSpan &points, double epsilon, double &lowerBound);
+
+    /*
+     * @brief Find the closest pair of points using the divide and conquer algorithm.
+     * @param points The points to search for the closest pair, such as a PointSet; they are read in place and never copied as a whole.
+     * @return The closest pair, identified by the positions of its points in the input.
+     * @pre The points must contain at least two points.
+     * @post The closest pair is returned without printing the per-call distances.
+     */
+    static PointPair findClosestPair(const PointSpan &points);
+
+    /*
+     * @brief Find the k closest pairs of points using the divide and conquer algorithm.
+     * @param points The points to search for the closest pairs, such as a PointSet.
+     * @param k The number of pairs to report.
+     * @return Up to k pairs sorted by increasing distance, identified by their positions in the input.
+     * @pre k is a non-negative integer.
+     * @post The k closest pairs (or every pair, if there are fewer) are returned.
+     */
+    static std::vector<PointPair> findKClosestPairs(const PointSpan &points, int k);
+
+    /*
+     * @brief Find the closest pair of points that have already been sorted by x-coordinate, skipping the presorting step.
+     * @param sortedPointsX The points sorted by x-coordinate.
+     * @return The closest pair, identified by the indices stored in the points.
+     * @pre The PointSet holds at least two points, each with a distinct index.
+     * @post The closest pair is returned without printing the per-call distances.
+     */
+    static PointPair findClosestPairPresorted(const PointSet &sortedPointsX);
+
+    /*
+     * @brief Time the closest pair search on a synthetic input for every supported leaf size and keep the fastest.
+     * @return The leaf size chosen, which findClosestPair and findClosestPairPresorted use from now on.
+     * @pre None.
+     * @post The leaf size is set to the fastest candidate on this machine. The first search calibrates on its own
+     *       if neither this function nor setLeafSize has been called.
+     */
+    static int calibrateLeafSize();
+
+    /*
+     * @brief Set the number of points below which the search switches to brute force.
+     * @param newLeafSize The new leaf size, from MIN_LEAF_SIZE to MAX_LEAF_SIZE.
+     * @pre None.
+     * @post The leaf size is updated, or left unchanged with an error message if it is out of range.
+     */
+    static void setLeafSize(int newLeafSize);
+
+    /*
+     * @brief Get the number of points below which the search switches to brute force.
+     * @return The current leaf size.
+     * @pre None.
+     * @post The leaf size is returned, after calibrating it once if it has not been chosen yet.
+     */
+    static int getLeafSize();
+
+    // Range of supported leaf sizes for findClosestPair and findClosestPairPresorted.
+    static const int MIN_LEAF_SIZE = 2;
+    static const int MAX_LEAF_SIZE = 64;
 
 private:
     /*
-     * @brief Recursive function to find the closest pair distance using the divide and conquer algorithm.
+     * @brief Coordinates and indices of a run of points, stored as separate arrays.
+     */
+    struct CoordinateArrays
+    {
+        std::vector<double> xs; // x-coordinates.
+        std::vector<double> ys; // y-coordinates.
+        std::vector<int> ids;   // Indices of the points.
+    };
+
+    /*
+     * @brief Find the closest pair of points sorted by x-coordinate with the allocation-free search.
+     * @param points The coordinates and indices of the points, sorted by x-coordinate.
+     * @param leafSize The number of points below which the search switches to brute force.
+     * @return The closest pair, identified by the indices stored with the points.
+     * @pre The arrays hold at least two points, and leafSize is from MIN_LEAF_SIZE to MAX_LEAF_SIZE.
+     * @post The closest pair is returned and the arrays are left sorted by y-coordinate.
+     */
+    static PointPair findClosestPairFast(CoordinateArrays &points, int leafSize);
+
+    /*
+     * @brief Time the closest pair search on a synthetic input for every supported leaf size.
+     * @return The fastest leaf size on this machine.
+     * @pre None.
+     * @post The chosen leaf size is left unchanged.
+     */
+    static int measureFastestLeafSize();
+
+    /*
+     * @brief Map a coordinate to an unsigned key with the same order, for the radix sort.
+     * @param value The coordinate, which must not be NaN.
+     * @return The key; keys compare like the coordinates they come from.
+     * @pre None.
+     * @post None.
+     */
+    static std::uint64_t toSortableKey(double value);
+
+    /*
+     * @brief Recursive allocation-free search, which leaves its range sorted by y-coordinate.
+     * @param points The points; the range is sorted by x-coordinate on entry and by y-coordinate on exit.
+     * @param scratch Buffer of the same size as points, used for merging and for the strip.
+     * @param leftIndex Index of the leftmost point.
+     * @param rightIndex Index of the rightmost point.
+     * @param bestSquaredDistance The squared distance of the closest pair found so far.
+     * @param bestFirstIndex The index of the first point of the closest pair found so far.
+     * @param bestSecondIndex The index of the second point of the closest pair found so far.
+     * @param leafSize The number of points below which the search switches to brute force.
+     * @pre The range holds at least one point.
+     * @post The best pair accounts for every pair in the range.
+     */
+    static void findClosestPairFastRecursive(CoordinateArrays &points, CoordinateArrays &scratch, int leftIndex, int rightIndex,
+                                             double &bestSquaredDistance, int &bestFirstIndex, int &bestSecondIndex, int leafSize);
+
+    /*
+     * @brief Compare every pair of a leaf, then sort the leaf by y-coordinate.
+     * @param points The points.
+     * @param leftIndex Index of the leftmost point of the leaf.
+     * @param rightIndex Index of the rightmost point of the leaf.
+     * @param bestSquaredDistance The squared distance of the closest pair found so far.
+     * @param bestFirstIndex The index of the first point of the closest pair found so far.
+     * @param bestSecondIndex The index of the second point of the closest pair found so far.
+     * @pre The leaf holds at most MAX_LEAF_SIZE points.
+     * @post The best pair accounts for every pair in the leaf, and the leaf is sorted by y-coordinate.
+     */
+    static void bruteForceLeaf(CoordinateArrays &points, int leftIndex, int rightIndex,
+                               double &bestSquaredDistance, int &bestFirstIndex, int &bestSecondIndex);
+
+    /*
+     * @brief Bucket the points into a hashed grid and measure the pairs of neighboring cells.
+     * @param xs The x-coordinates of the points.
+     * @param ys The y-coordinates of the points.
+     * @param minX The smallest x-coordinate of the points.
+     * @param minY The smallest y-coordinate of the points.
+     * @param cellSize The side of a grid cell.
+     * @param crowded Receives whether some bucket holds more than MAX_BUCKET_POINTS points, in which case the search stops.
+     * @return Unless crowded, the smallest squared distance among pairs that include every pair in the same or adjacent cells.
+     * @pre cellSize is positive and every point is fewer than MAX_GRID_CELLS cells from the minimum on both axes.
+     * @post No side effects on the points.
+     */
+    static double searchGrid(const std::vector<double> &xs, const std::vector<double> &ys, double minX, double minY, double cellSize, bool &crowded);
+
+    /*
+     * @brief Sort a copy of the points by x- and y-coordinate, tagging each point with its input position.
+     * @param points The points to sort.
+     * @param sortedPointsX The PointSet to receive the points sorted by x-coordinate (ties broken by y, then input position).
+     * @param sortedPointsY The PointSet to receive the points sorted by y-coordinate.
+     * @pre None.
+     * @post Both output PointSets hold every input point, with the index set to its input position.
+     */
+    static void presortPoints(const PointSpan &points, PointSet &sortedPointsX, PointSet &sortedPointsY);
+
+    /*
+     * @brief Split the points of a subproblem, sorted by y-coordinate, into its left and right halves.
+     * @param sortedPointsY The PointSet containing the points of the subproblem sorted by y-coordinate.
+     * @param midPoint The last point of the left half in x-order.
+     * @param leftSortedPointsY The PointSet to receive the left half, sorted by y-coordinate.
+     * @param rightSortedPointsY The PointSet to receive the right half, sorted by y-coordinate.
+     * @param isLeft Receives, for every point of sortedPointsY, whether it was placed in the left half.
+     * @pre sortedPointsY holds exactly the points of the subproblem.
+     * @post The two halves are filled in y-order, consistent with the x-order split at midPoint.
+     */
+    static void splitByMidPoint(const PointSet &sortedPointsY, const Point &midPoint,
+                                PointSet &leftSortedPointsY, PointSet &rightSortedPointsY, std::vector<bool> &isLeft);
+
+    /*
+     * @brief Recursive function to find the closest pair using the divide and conquer algorithm.
      * @param sortedPointsX The PointSet containing the points sorted by x-coordinate.
      * @param sortedPointsY The PointSet containing the points sorted by y-coordinate.
      * @param leftIndex Index of the leftmost point.
      * @param rightIndex Index of the rightmost point.
-     * @return The distance between the closest pair of points in the specified range.
+     * @param printTrace Whether to print the distance found by every recursive call.
+     * @return The closest pair of points in the specified range.
      * @pre The PointSet objects must not be empty.
-     * @post The distance between the closest pair of points in the specified range is returned.
+     * @post The closest pair of points in the specified range is returned.
      */
-    static double findClosestPairRecursive(const PointSet &sortedPointsX, const PointSet &sortedPointsY, int leftIndex, int rightIndex);
+    static PointPair findClosestPairRecursive(const PointSet &sortedPointsX, const PointSet &sortedPointsY, int leftIndex, int rightIndex, bool printTrace);
 
     /*
-     * @brief Calculate the closest pair distance using a brute-force method.
+     * @brief Recursive function to collect the k closest pairs using the divide and conquer algorithm.
+     * @param sortedPointsX The PointSet containing the points sorted by x-coordinate.
+     * @param sortedPointsY The PointSet containing the points sorted by y-coordinate.
+     * @param leftIndex Index of the leftmost point.
+     * @param rightIndex Index of the rightmost point.
+     * @param k The number of pairs to keep.
+     * @param closestPairs Bounded max-heap holding the k closest pairs found so far.
+     * @pre The PointSet objects must not be empty and k is positive.
+     * @post Every pair in the specified range closer than the current k-th distance has been offered to the heap.
+     */
+    static void findKClosestPairsRecursive(const PointSet &sortedPointsX, const PointSet &sortedPointsY, int leftIndex, int rightIndex,
+                                           int k, std::priority_queue<PointPair> &closestPairs);
+
+    /*
+     * @brief Calculate the closest pair using a brute-force method.
      * @param points The PointSet containing the points.
      * @param leftIndex Index of the leftmost point.
      * @param rightIndex Index of the rightmost point.
-     * @return The distance between the closest pair of points in the specified range.
+     * @return The closest pair of points in the specified range.
      * @pre The PointSet object must not be empty.
-     * @post The distance between the closest pair of points in the specified range is returned.
+     * @post The closest pair of points in the specified range is returned.
      */
-    static double bruteForceClosestPairDistance(const PointSet &points, int leftIndex, int rightIndex);
+    static PointPair bruteForceClosestPair(const PointSet &points, int leftIndex, int rightIndex);
+
+    /*
+     * @brief Offer a pair to a bounded max-heap of the k closest pairs.
+     * @param closestPairs The heap holding at most k pairs, farthest on top.
+     * @param k The maximum number of pairs to keep.
+     * @param a The first point of the pair.
+     * @param b The second point of the pair.
+     * @pre k is positive.
+     * @post The pair is kept if the heap has room or it is closer than the current k-th pair.
+     */
+    static void offerPair(std::priority_queue<PointPair> &closestPairs, int k, const Point &a, const Point &b);
+
+    /*
+     * @brief Get the current k-th smallest distance bound of a bounded max-heap.
+     * @param closestPairs The heap holding at most k pairs, farthest on top.
+     * @param k The maximum number of pairs to keep.
+     * @return The distance of the farthest kept pair, or the maximum possible distance while the heap has room.
+     * @pre k is positive.
+     * @post No side effects on the heap.
+     */
+    static double getKthDistance(const std::priority_queue<PointPair> &closestPairs, int k);
 
     /*
      * @brief Helper function to print information about the closest pair of points.
@@ -73,4 +289,17 @@ private:
      * @post The minimum value between firstValue and secondValue is returned.
      */
     static double getMinimumValue(double firstValue, double secondValue);
+
+    /*
+     * @brief Returns the closer of two pairs.
+     * @param firstPair The first pair.
+     * @param secondPair The second pair.
+     * @return The pair with the smaller distance, preferring the first on ties.
+     * @pre Both pairs are valid PointPair objects.
+     * @post The closer pair is returned.
+     */
+    static PointPair getCloserPair(const PointPair &firstPair, const PointPair &secondPair);
+
+    static std::atomic<int> chosenLeafSize; // Points per brute-force leaf of findClosestPair and findClosestPairPresorted, or 0 until chosen.
+    static std::once_flag calibrationFlag;   // Guards the calibration on first use.
 };
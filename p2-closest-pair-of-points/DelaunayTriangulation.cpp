@@ -0,0 +1,462 @@
+/*
+ * @file DelaunayTriangulation.cpp
+ * @brief Implementation of the DelaunayTriangulation class and the proximity structures derived from it.
+ *
+ * This file contains the implementation of the DelaunayTriangulation class. The points are sorted by
+ * (x, y) and duplicates are set aside, then the Guibas-Stolfi recursion triangulates each half and stitches
+ * the halves together bottom to top, deleting edges that fail the in-circle test as it rises. The derived
+ * structures only look at the surviving edges: Kruskal's algorithm with a union-find for the minimum
+ * spanning tree, and a single pass over the edges for nearest neighbors and the closest pair.
+ *
+ * @author Phat Tran
+ */
+
+#include "DelaunayTriangulation.h"
+#include "GeometricPredicates.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+/*
+ * @brief Constructor for DelaunayTriangulation class.
+ * @param points The points to triangulate, such as a PointSet.
+ * @pre None.
+ * @post The Delaunay triangulation of the points is built.
+ */
+DelaunayTriangulation::DelaunayTriangulation(const PointSpan &points)
+{
+    // Sort the input positions by (x, y)
+    int size = static_cast<int>(points.size());
+    vector<int> order(size);
+    for (int i = 0; i < size; i++)
+    {
+        order[i] = i;
+    }
+    sort(order.begin(), order.end(), [&points](int a, int b)
+         {
+             if (points.getX(a) != points.getX(b))
+             {
+                 return points.getX(a) < points.getX(b);
+             }
+             return (points.getY(a) != points.getY(b)) ? points.getY(a) < points.getY(b) : a < b;
+         });
+
+    // Keep the first copy of every distinct point and remember the duplicates
+    for (int i = 0; i < size; i++)
+    {
+        double x = points.getX(order[i]);
+        double y = points.getY(order[i]);
+        if (!this->xs.empty() && x == this->xs.back() && y == this->ys.back())
+        {
+            this->copies.push_back(make_pair(order[i], this->ids.back()));
+            continue;
+        }
+        this->xs.push_back(x);
+        this->ys.push_back(y);
+        this->ids.push_back(order[i]);
+    }
+
+    // A triangulation has at most 3n edges
+    this->next.reserve(12 * this->xs.size());
+    this->origin.reserve(12 * this->xs.size());
+    if (this->xs.size() >= 2)
+    {
+        int leftEdge, rightEdge;
+        triangulate(0, static_cast<int>(this->xs.size()), leftEdge, rightEdge);
+    }
+}
+
+/*
+ * @brief Destructor for DelaunayTriangulation class.
+ * @pre None.
+ * @post The DelaunayTriangulation object and its associated resources are deallocated.
+ */
+DelaunayTriangulation::~DelaunayTriangulation() {}
+
+/*
+ * @brief Get the edges of the triangulation.
+ * @return Every edge as a pair of input indices. A duplicated point is joined to its first copy by a zero-length edge.
+ * @pre None.
+ * @post The edges are returned.
+ */
+vector<pair<int, int>> DelaunayTriangulation::getEdges() const
+{
+    vector<pair<int, int>> edges;
+    for (size_t quad = 0; quad < this->deleted.size(); quad++)
+    {
+        if (!this->deleted[quad])
+        {
+            int e = static_cast<int>(4 * quad);
+            edges.push_back(make_pair(this->ids[org(e)], this->ids[dest(e)]));
+        }
+    }
+    edges.insert(edges.end(), this->copies.begin(), this->copies.end());
+    return edges;
+}
+
+/*
+ * @brief Compute the Euclidean minimum spanning tree with Kruskal's algorithm on the Delaunay edges.
+ * @return The n - 1 tree edges in increasing order of length, identified by input indices.
+ * @pre None.
+ * @post The minimum spanning tree is returned.
+ */
+vector<PointPair> DelaunayTriangulation::computeMinimumSpanningTree() const
+{
+    // Measure every edge; input indices cover the distinct points and their copies
+    vector<pair<int, int>> edges = getEdges();
+    vector<PointPair> candidates;
+    candidates.reserve(edges.size());
+    int pointCount = static_cast<int>(this->ids.size() + this->copies.size());
+    vector<double> pointXs(pointCount), pointYs(pointCount);
+    for (size_t i = 0; i < this->ids.size(); i++)
+    {
+        pointXs[this->ids[i]] = this->xs[i];
+        pointYs[this->ids[i]] = this->ys[i];
+    }
+    for (const pair<int, int> &copy : this->copies)
+    {
+        pointXs[copy.first] = pointXs[copy.second];
+        pointYs[copy.first] = pointYs[copy.second];
+    }
+    for (const pair<int, int> &edge : edges)
+    {
+        double dx = pointXs[edge.first] - pointXs[edge.second];
+        double dy = pointYs[edge.first] - pointYs[edge.second];
+        candidates.push_back(PointPair(edge.first, edge.second, sqrt(dx * dx + dy * dy)));
+    }
+    sort(candidates.begin(), candidates.end());
+
+    // Kruskal's algorithm with a union-find using path halving and union by size
+    vector<int> parent(pointCount), componentSize(pointCount, 1);
+    for (int i = 0; i < pointCount; i++)
+    {
+        parent[i] = i;
+    }
+    auto findRoot = [&parent](int v)
+    {
+        while (parent[v] != v)
+        {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    };
+
+    vector<PointPair> tree;
+    for (const PointPair &candidate : candidates)
+    {
+        int a = findRoot(candidate.getFirstIndex());
+        int b = findRoot(candidate.getSecondIndex());
+        if (a == b)
+        {
+            continue;
+        }
+        if (componentSize[a] < componentSize[b])
+        {
+            swap(a, b);
+        }
+        parent[b] = a;
+        componentSize[a] += componentSize[b];
+        tree.push_back(candidate);
+        if (static_cast<int>(tree.size()) == pointCount - 1)
+        {
+            break;
+        }
+    }
+    return tree;
+}
+
+/*
+ * @brief Find the nearest neighbor of every point from the Delaunay edges.
+ * @return For each point, the input index of its nearest other point (-1 if there are fewer than two points).
+ * @pre None.
+ * @post The nearest neighbor index of every point is returned.
+ */
+vector<int> DelaunayTriangulation::findAllNearestNeighbors() const
+{
+    int pointCount = static_cast<int>(this->ids.size() + this->copies.size());
+    vector<int> nearestNeighbors(pointCount, -1);
+    vector<double> nearestDistances(pointCount, 0.0);
+
+    vector<double> pointXs(pointCount), pointYs(pointCount);
+    for (size_t i = 0; i < this->ids.size(); i++)
+    {
+        pointXs[this->ids[i]] = this->xs[i];
+        pointYs[this->ids[i]] = this->ys[i];
+    }
+    for (const pair<int, int> &copy : this->copies)
+    {
+        pointXs[copy.first] = pointXs[copy.second];
+        pointYs[copy.first] = pointYs[copy.second];
+    }
+
+    // Every point's nearest neighbor is joined to it by a Delaunay edge
+    for (const pair<int, int> &edge : getEdges())
+    {
+        double dx = pointXs[edge.first] - pointXs[edge.second];
+        double dy = pointYs[edge.first] - pointYs[edge.second];
+        double squaredDistance = dx * dx + dy * dy;
+        if (nearestNeighbors[edge.first] < 0 || squaredDistance < nearestDistances[edge.first])
+        {
+            nearestNeighbors[edge.first] = edge.second;
+            nearestDistances[edge.first] = squaredDistance;
+        }
+        if (nearestNeighbors[edge.second] < 0 || squaredDistance < nearestDistances[edge.second])
+        {
+            nearestNeighbors[edge.second] = edge.first;
+            nearestDistances[edge.second] = squaredDistance;
+        }
+    }
+    return nearestNeighbors;
+}
+
+/*
+ * @brief Find the closest pair as the shortest Delaunay edge.
+ * @return The closest pair, or an empty pair if there are fewer than two points.
+ * @pre None.
+ * @post The closest pair is returned.
+ */
+PointPair DelaunayTriangulation::findClosestPair() const
+{
+    // A duplicated point is always a closest pair
+    if (!this->copies.empty())
+    {
+        return PointPair(this->copies[0].first, this->copies[0].second, 0.0);
+    }
+
+    PointPair closestPair;
+    for (size_t quad = 0; quad < this->deleted.size(); quad++)
+    {
+        if (!this->deleted[quad])
+        {
+            int e = static_cast<int>(4 * quad);
+            double dx = this->xs[org(e)] - this->xs[dest(e)];
+            double dy = this->ys[org(e)] - this->ys[dest(e)];
+            double distance = sqrt(dx * dx + dy * dy);
+            if (distance < closestPair.getDistance())
+            {
+                closestPair = PointPair(this->ids[org(e)], this->ids[dest(e)], distance);
+            }
+        }
+    }
+    return closestPair;
+}
+
+/*
+ * @brief Build the triangulation of the sorted, distinct points in a range.
+ * @param leftIndex Index of the first point of the range.
+ * @param rightIndex Index one past the last point of the range.
+ * @param leftEdge Receives the counterclockwise convex hull edge out of the leftmost point.
+ * @param rightEdge Receives the clockwise convex hull edge out of the rightmost point.
+ * @pre The range holds at least two points.
+ * @post The range is triangulated.
+ */
+void DelaunayTriangulation::triangulate(int leftIndex, int rightIndex, int &leftEdge, int &rightEdge)
+{
+    int size = rightIndex - leftIndex;
+
+    // Base case: a single edge
+    if (size == 2)
+    {
+        int a = makeEdge();
+        this->origin[a] = leftIndex;
+        this->origin[sym(a)] = leftIndex + 1;
+        leftEdge = a;
+        rightEdge = sym(a);
+        return;
+    }
+
+    // Base case: two edges, closed into a triangle unless the points are collinear
+    if (size == 3)
+    {
+        int s1 = leftIndex, s2 = leftIndex + 1, s3 = leftIndex + 2;
+        int a = makeEdge();
+        int b = makeEdge();
+        splice(sym(a), b);
+        this->origin[a] = s1;
+        this->origin[sym(a)] = s2;
+        this->origin[b] = s2;
+        this->origin[sym(b)] = s3;
+
+        if (ccw(s1, s2, s3))
+        {
+            connect(b, a);
+            leftEdge = a;
+            rightEdge = sym(b);
+        }
+        else if (ccw(s1, s3, s2))
+        {
+            int c = connect(b, a);
+            leftEdge = sym(c);
+            rightEdge = c;
+        }
+        else
+        {
+            leftEdge = a;
+            rightEdge = sym(b);
+        }
+        return;
+    }
+
+    // Triangulate both halves
+    int mid = leftIndex + size / 2;
+    int leftOuter, leftInner, rightInner, rightOuter;
+    triangulate(leftIndex, mid, leftOuter, leftInner);
+    triangulate(mid, rightIndex, rightInner, rightOuter);
+
+    // Find the lower common tangent of the two halves
+    while (true)
+    {
+        if (ccw(org(rightInner), org(leftInner), dest(leftInner)))
+        {
+            leftInner = lnext(leftInner);
+        }
+        else if (ccw(org(leftInner), dest(rightInner), org(rightInner)))
+        {
+            rightInner = rprev(rightInner);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Create the first cross edge from the right half to the left half
+    int base = connect(sym(rightInner), leftInner);
+    if (org(leftInner) == org(leftOuter))
+    {
+        leftOuter = sym(base);
+    }
+    if (org(rightInner) == org(rightOuter))
+    {
+        rightOuter = base;
+    }
+
+    // Merge upward, one cross edge at a time
+    while (true)
+    {
+        // A candidate is valid if it lies above the current base edge
+        int leftCandidate = onext(sym(base));
+        bool leftValid = ccw(dest(leftCandidate), dest(base), org(base));
+        if (leftValid)
+        {
+            while (inCircle(dest(base), org(base), dest(leftCandidate), dest(onext(leftCandidate))))
+            {
+                int t = onext(leftCandidate);
+                deleteEdge(leftCandidate);
+                leftCandidate = t;
+            }
+        }
+
+        int rightCandidate = oprev(base);
+        bool rightValid = ccw(dest(rightCandidate), dest(base), org(base));
+        if (rightValid)
+        {
+            while (inCircle(dest(base), org(base), dest(rightCandidate), dest(oprev(rightCandidate))))
+            {
+                int t = oprev(rightCandidate);
+                deleteEdge(rightCandidate);
+                rightCandidate = t;
+            }
+        }
+
+        // The upper common tangent has been reached
+        if (!leftValid && !rightValid)
+        {
+            break;
+        }
+
+        // Connect to whichever candidate's circle is empty of the other
+        if (!leftValid || (rightValid && inCircle(dest(leftCandidate), org(leftCandidate), org(rightCandidate), dest(rightCandidate))))
+        {
+            base = connect(rightCandidate, sym(base));
+        }
+        else
+        {
+            base = connect(sym(base), sym(leftCandidate));
+        }
+    }
+
+    leftEdge = leftOuter;
+    rightEdge = rightOuter;
+}
+
+/*
+ * @brief Create a new isolated quad-edge.
+ * @return The primal edge of the new quad-edge.
+ */
+int DelaunayTriangulation::makeEdge()
+{
+    int e = static_cast<int>(this->next.size());
+    this->next.push_back(e);
+    this->next.push_back(e + 3);
+    this->next.push_back(e + 2);
+    this->next.push_back(e + 1);
+    this->origin.insert(this->origin.end(), 4, -1);
+    this->deleted.push_back(false);
+    return e;
+}
+
+/*
+ * @brief Splice the edge rings of a and b (Guibas and Stolfi's topological operator).
+ * @param a The first edge.
+ * @param b The second edge.
+ */
+void DelaunayTriangulation::splice(int a, int b)
+{
+    int alpha = rot(onext(a));
+    int beta = rot(onext(b));
+    swap(this->next[a], this->next[b]);
+    swap(this->next[alpha], this->next[beta]);
+}
+
+/*
+ * @brief Add an edge from the destination of a to the origin of b, in the same face.
+ * @param a The first edge.
+ * @param b The second edge.
+ * @return The new edge.
+ */
+int DelaunayTriangulation::connect(int a, int b)
+{
+    int e = makeEdge();
+    this->origin[e] = dest(a);
+    this->origin[sym(e)] = org(b);
+    splice(e, lnext(a));
+    splice(sym(e), b);
+    return e;
+}
+
+/*
+ * @brief Detach an edge from the structure and mark it deleted.
+ * @param e The edge to delete.
+ */
+void DelaunayTriangulation::deleteEdge(int e)
+{
+    splice(e, oprev(e));
+    splice(sym(e), oprev(sym(e)));
+    this->deleted[e / 4] = true;
+}
+
+/*
+ * @brief Test whether three sorted points are in counterclockwise order.
+ * @return True if the points a, b, c turn counterclockwise.
+ * @pre The indices refer to sorted points.
+ * @post None.
+ */
+bool DelaunayTriangulation::ccw(int a, int b, int c) const
+{
+    return GeometricPredicates::orient2d(this->xs[a], this->ys[a], this->xs[b], this->ys[b], this->xs[c], this->ys[c]) > 0.0;
+}
+
+/*
+ * @brief Test whether a sorted point lies strictly inside the circle through three others.
+ * @return True if d lies inside the circle through a, b, c.
+ * @pre The indices refer to sorted points and a, b, c are in counterclockwise order.
+ * @post None.
+ */
+bool DelaunayTriangulation::inCircle(int a, int b, int c, int d) const
+{
+    return GeometricPredicates::incircle(this->xs[a], this->ys[a], this->xs[b], this->ys[b], this->xs[c], this->ys[c],
+                                         this->xs[d], this->ys[d]) > 0.0;
+}
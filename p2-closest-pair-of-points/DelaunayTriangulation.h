@@ -0,0 +1,128 @@
+/*
+ * @file DelaunayTriangulation.h
+ * @brief Declaration of the DelaunayTriangulation class and the proximity structures derived from it.
+ *
+ * This file contains the declaration of the DelaunayTriangulation class, which computes the Delaunay
+ * triangulation of a PointSet with the Guibas-Stolfi divide and conquer algorithm on a quad-edge structure.
+ * Because the Euclidean minimum spanning tree, the nearest neighbor graph and the closest pair are all
+ * subgraphs of the Delaunay triangulation, the class also derives them from its O(n) edges in
+ * O(n log n) time. Orientation and in-circle tests use the robust GeometricPredicates.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include "PointSpan.h"
+#include "PointPair.h"
+#include <utility>
+#include <vector>
+
+/*
+ * @brief Class representing the Delaunay triangulation of a set of points.
+ */
+class DelaunayTriangulation
+{
+public:
+    /*
+     * @brief Constructor for DelaunayTriangulation class.
+     * @param points The points to triangulate, such as a PointSet.
+     * @pre None.
+     * @post The Delaunay triangulation of the points is built.
+     */
+    explicit DelaunayTriangulation(const PointSpan &points);
+
+    /*
+     * @brief Destructor for DelaunayTriangulation class.
+     * @pre None.
+     * @post The DelaunayTriangulation object and its associated resources are deallocated.
+     */
+    ~DelaunayTriangulation();
+
+    /*
+     * @brief Get the edges of the triangulation.
+     * @return Every edge as a pair of input indices. A duplicated point is joined to its first copy by a zero-length edge.
+     * @pre None.
+     * @post The edges are returned.
+     */
+    std::vector<std::pair<int, int>> getEdges() const;
+
+    /*
+     * @brief Compute the Euclidean minimum spanning tree with Kruskal's algorithm on the Delaunay edges.
+     * @return The n - 1 tree edges in increasing order of length, identified by input indices.
+     * @pre None.
+     * @post The minimum spanning tree is returned.
+     */
+    std::vector<PointPair> computeMinimumSpanningTree() const;
+
+    /*
+     * @brief Find the nearest neighbor of every point from the Delaunay edges.
+     * @return For each point, the input index of its nearest other point (-1 if there are fewer than two points).
+     * @pre None.
+     * @post The nearest neighbor index of every point is returned.
+     */
+    std::vector<int> findAllNearestNeighbors() const;
+
+    /*
+     * @brief Find the closest pair as the shortest Delaunay edge.
+     * @return The closest pair, or an empty pair if there are fewer than two points.
+     * @pre None.
+     * @post The closest pair is returned.
+     */
+    PointPair findClosestPair() const;
+
+private:
+    /*
+     * @brief Build the triangulation of the sorted, distinct points in a range.
+     * @param leftIndex Index of the first point of the range.
+     * @param rightIndex Index one past the last point of the range.
+     * @param leftEdge Receives the counterclockwise convex hull edge out of the leftmost point.
+     * @param rightEdge Receives the clockwise convex hull edge out of the rightmost point.
+     * @pre The range holds at least two points.
+     * @post The range is triangulated.
+     */
+    void triangulate(int leftIndex, int rightIndex, int &leftEdge, int &rightEdge);
+
+    // ----------------------------------------- Quad-edge operations -----------------------------------------
+    // A quad-edge groups four directed edges 4q .. 4q + 3: the primal edge, its dual, the reversed primal
+    // edge, and the reversed dual. Only primal edges carry an origin vertex.
+    int makeEdge();
+    void splice(int a, int b);
+    int connect(int a, int b);
+    void deleteEdge(int e);
+    static int rot(int e) { return (e & ~3) | ((e + 1) & 3); }
+    static int sym(int e) { return (e & ~3) | ((e + 2) & 3); }
+    static int invRot(int e) { return (e & ~3) | ((e + 3) & 3); }
+    int onext(int e) const { return this->next[e]; }
+    int oprev(int e) const { return rot(this->next[rot(e)]); }
+    int lnext(int e) const { return rot(this->next[invRot(e)]); }
+    int rprev(int e) const { return this->next[sym(e)]; }
+    int org(int e) const { return this->origin[e]; }
+    int dest(int e) const { return this->origin[sym(e)]; }
+    // --------------------------------------------------------------------------------------------------------
+
+    /*
+     * @brief Test whether three sorted points are in counterclockwise order.
+     * @return True if the points a, b, c turn counterclockwise.
+     * @pre The indices refer to sorted points.
+     * @post None.
+     */
+    bool ccw(int a, int b, int c) const;
+
+    /*
+     * @brief Test whether a sorted point lies strictly inside the circle through three others.
+     * @return True if d lies inside the circle through a, b, c.
+     * @pre The indices refer to sorted points and a, b, c are in counterclockwise order.
+     * @post None.
+     */
+    bool inCircle(int a, int b, int c, int d) const;
+
+    std::vector<double> xs;                  // x-coordinates of the distinct points, sorted by (x, y).
+    std::vector<double> ys;                  // y-coordinates of the distinct points, sorted by (x, y).
+    std::vector<int> ids;                    // Input index of each distinct point.
+    std::vector<std::pair<int, int>> copies; // (duplicate input index, input index of its first copy).
+    std::vector<int> next;                   // Onext of every directed edge.
+    std::vector<int> origin;                 // Origin of every directed edge, as a sorted point index.
+    std::vector<bool> deleted;               // Whether each quad-edge has been deleted.
+};
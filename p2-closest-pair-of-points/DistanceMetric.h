@@ -0,0 +1,435 @@
+/*
+ * @file DistanceMetric.h
+ * @brief Declaration and implementation of the distance metric policies for the generic closest pair engine.
+ *
+ * This file defines the metric policies that GenericClosestPairAlgorithm takes as a template parameter:
+ * EuclideanMetric, ManhattanMetric, ChebyshevMetric and WeightedLpMetric. Each policy compares points through
+ * a key that is monotone in the distance: the squared distance for L2, the plain sum for L1, the maximum for
+ * L-infinity, and the weighted sum of p-th powers for weighted Lp. Keys are built from per-axis terms with
+ * additions, multiplications and maxima only, so the search never calls sqrt or pow; toDistance converts
+ * the final key back into a distance. The term of a single axis never exceeds the key of the whole pair,
+ * which is what lets the engine discard points by their difference along one axis. Being templates or
+ * trivially small, all policies are implemented in this header.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * @brief Traits selecting the type used to hold squared distances for a coordinate type.
+ */
+template <typename Coordinate>
+struct SquaredDistanceTraits
+{
+    // Integer coordinates are widened to 64 bits so squared distances stay exact, provided coordinate
+    // differences stay below 2^31 in 2D (and proportionally less in higher dimensions).
+    typedef typename std::conditional<std::is_integral<Coordinate>::value, std::int64_t, Coordinate>::type Type;
+};
+
+/*
+ * @brief Euclidean (L2) metric, compared by squared distance.
+ */
+struct EuclideanMetric
+{
+    /*
+     * @brief Traits selecting the key type for a coordinate type: exact 64-bit integers for integer coordinates.
+     */
+    template <typename Coordinate>
+    struct KeyTraits
+    {
+        typedef typename SquaredDistanceTraits<Coordinate>::Type Type;
+    };
+
+    /*
+     * @brief Calculate the key term of one axis.
+     * @param difference The coordinate difference along the axis, already widened to the key type.
+     * @param axis The axis of the difference.
+     * @return The squared difference.
+     * @pre None.
+     * @post None.
+     */
+    template <typename Key>
+    Key calculateAxisKey(Key difference, int axis) const;
+
+    /*
+     * @brief Add the term of one more axis to a partial key.
+     * @param key The key of the axes so far.
+     * @param axisKey The term of the next axis.
+     * @return The sum of the two.
+     * @pre None.
+     * @post None.
+     */
+    template <typename Key>
+    Key combineKeys(Key key, Key axisKey) const;
+
+    /*
+     * @brief Convert a key into a distance.
+     * @param key The squared distance.
+     * @return The distance.
+     * @pre key is non-negative.
+     * @post None.
+     */
+    template <typename Key>
+    static double toDistance(Key key);
+};
+
+/*
+ * @brief Manhattan (L1) metric, compared by the distance itself.
+ */
+struct ManhattanMetric
+{
+    /*
+     * @brief Traits selecting the key type for a coordinate type: exact 64-bit integers for integer coordinates.
+     */
+    template <typename Coordinate>
+    struct KeyTraits
+    {
+        typedef typename SquaredDistanceTraits<Coordinate>::Type Type;
+    };
+
+    /*
+     * @brief Calculate the key term of one axis.
+     * @param difference The coordinate difference along the axis, already widened to the key type.
+     * @param axis The axis of the difference.
+     * @return The absolute difference.
+     * @pre None.
+     * @post None.
+     */
+    template <typename Key>
+    Key calculateAxisKey(Key difference, int axis) const;
+
+    /*
+     * @brief Add the term of one more axis to a partial key.
+     * @param key The key of the axes so far.
+     * @param axisKey The term of the next axis.
+     * @return The sum of the two.
+     * @pre None.
+     * @post None.
+     */
+    template <typename Key>
+    Key combineKeys(Key key, Key axisKey) const;
+
+    /*
+     * @brief Convert a key into a distance.
+     * @param key The Manhattan distance.
+     * @return The distance, which is the key itself.
+     * @pre key is non-negative.
+     * @post None.
+     */
+    template <typename Key>
+    static double toDistance(Key key);
+};
+
+/*
+ * @brief Chebyshev (L-infinity) metric, compared by the distance itself.
+ */
+struct ChebyshevMetric
+{
+    /*
+     * @brief Traits selecting the key type for a coordinate type: exact 64-bit integers for integer coordinates.
+     */
+    template <typename Coordinate>
+    struct KeyTraits
+    {
+        typedef typename SquaredDistanceTraits<Coordinate>::Type Type;
+    };
+
+    /*
+     * @brief Calculate the key term of one axis.
+     * @param difference The coordinate difference along the axis, already widened to the key type.
+     * @param axis The axis of the difference.
+     * @return The absolute difference.
+     * @pre None.
+     * @post None.
+     */
+    template <typename Key>
+    Key calculateAxisKey(Key difference, int axis) const;
+
+    /*
+     * @brief Add the term of one more axis to a partial key.
+     * @param key The key of the axes so far.
+     * @param axisKey The term of the next axis.
+     * @return The larger of the two.
+     * @pre None.
+     * @post None.
+     */
+    template <typename Key>
+    Key combineKeys(Key key, Key axisKey) const;
+
+    /*
+     * @brief Convert a key into a distance.
+     * @param key The Chebyshev distance.
+     * @return The distance, which is the key itself.
+     * @pre key is non-negative.
+     * @post None.
+     */
+    template <typename Key>
+    static double toDistance(Key key);
+};
+
+/*
+ * @brief Weighted Lp metric with an integer exponent, (sum of w_i |d_i|^p)^(1/p), compared by the p-th power.
+ */
+template <int Exponent, int Dimension>
+class WeightedLpMetric
+{
+    static_assert(Exponent >= 1, "WeightedLpMetric requires an exponent of at least 1.");
+
+public:
+    /*
+     * @brief Traits selecting the key type for a coordinate type: always double, as weights are real.
+     */
+    template <typename Coordinate>
+    struct KeyTraits
+    {
+        typedef double Type;
+    };
+
+    /*
+     * @brief Constructor for WeightedLpMetric class.
+     * @param weights The weight of every axis, optional with every weight 1 by default.
+     * @pre Every weight is positive.
+     * @post A WeightedLpMetric object is created with the specified weights.
+     */
+    explicit WeightedLpMetric(const std::array<double, Dimension> &weights = unitWeights());
+
+    /*
+     * @brief Calculate the key term of one axis.
+     * @param difference The coordinate difference along the axis.
+     * @param axis The axis of the difference.
+     * @return The weight of the axis times the absolute difference to the power Exponent.
+     * @pre axis is a valid axis.
+     * @post None.
+     */
+    double calculateAxisKey(double difference, int axis) const;
+
+    /*
+     * @brief Add the term of one more axis to a partial key.
+     * @param key The key of the axes so far.
+     * @param axisKey The term of the next axis.
+     * @return The sum of the two.
+     * @pre None.
+     * @post None.
+     */
+    double combineKeys(double key, double axisKey) const;
+
+    /*
+     * @brief Convert a key into a distance.
+     * @param key The weighted sum of powers.
+     * @return The Exponent-th root of the key.
+     * @pre key is non-negative.
+     * @post None.
+     */
+    static double toDistance(double key);
+
+private:
+    /*
+     * @brief Get a weight of 1 for every axis.
+     * @return The unit weights.
+     * @pre None.
+     * @post None.
+     */
+    static std::array<double, Dimension> unitWeights();
+
+    std::array<double, Dimension> weights; // Weight of every axis.
+};
+
+/*
+ * @brief Calculate the key term of one axis.
+ * @param difference The coordinate difference along the axis, already widened to the key type.
+ * @param axis The axis of the difference.
+ * @return The squared difference.
+ * @pre None.
+ * @post None.
+ */
+template <typename Key>
+Key EuclideanMetric::calculateAxisKey(Key difference, [[maybe_unused]] int axis) const
+{
+    return difference * difference;
+}
+
+/*
+ * @brief Add the term of one more axis to a partial key.
+ * @param key The key of the axes so far.
+ * @param axisKey The term of the next axis.
+ * @return The sum of the two.
+ * @pre None.
+ * @post None.
+ */
+template <typename Key>
+Key EuclideanMetric::combineKeys(Key key, Key axisKey) const
+{
+    return key + axisKey;
+}
+
+/*
+ * @brief Convert a key into a distance.
+ * @param key The squared distance.
+ * @return The distance.
+ * @pre key is non-negative.
+ * @post None.
+ */
+template <typename Key>
+double EuclideanMetric::toDistance(Key key)
+{
+    return std::sqrt(static_cast<double>(key));
+}
+
+/*
+ * @brief Calculate the key term of one axis.
+ * @param difference The coordinate difference along the axis, already widened to the key type.
+ * @param axis The axis of the difference.
+ * @return The absolute difference.
+ * @pre None.
+ * @post None.
+ */
+template <typename Key>
+Key ManhattanMetric::calculateAxisKey(Key difference, [[maybe_unused]] int axis) const
+{
+    return (difference < Key()) ? -difference : difference;
+}
+
+/*
+ * @brief Add the term of one more axis to a partial key.
+ * @param key The key of the axes so far.
+ * @param axisKey The term of the next axis.
+ * @return The sum of the two.
+ * @pre None.
+ * @post None.
+ */
+template <typename Key>
+Key ManhattanMetric::combineKeys(Key key, Key axisKey) const
+{
+    return key + axisKey;
+}
+
+/*
+ * @brief Convert a key into a distance.
+ * @param key The Manhattan distance.
+ * @return The distance, which is the key itself.
+ * @pre key is non-negative.
+ * @post None.
+ */
+template <typename Key>
+double ManhattanMetric::toDistance(Key key)
+{
+    return static_cast<double>(key);
+}
+
+/*
+ * @brief Calculate the key term of one axis.
+ * @param difference The coordinate difference along the axis, already widened to the key type.
+ * @param axis The axis of the difference.
+ * @return The absolute difference.
+ * @pre None.
+ * @post None.
+ */
+template <typename Key>
+Key ChebyshevMetric::calculateAxisKey(Key difference, [[maybe_unused]] int axis) const
+{
+    return (difference < Key()) ? -difference : difference;
+}
+
+/*
+ * @brief Add the term of one more axis to a partial key.
+ * @param key The key of the axes so far.
+ * @param axisKey The term of the next axis.
+ * @return The larger of the two.
+ * @pre None.
+ * @post None.
+ */
+template <typename Key>
+Key ChebyshevMetric::combineKeys(Key key, Key axisKey) const
+{
+    return (axisKey > key) ? axisKey : key;
+}
+
+/*
+ * @brief Convert a key into a distance.
+ * @param key The Chebyshev distance.
+ * @return The distance, which is the key itself.
+ * @pre key is non-negative.
+ * @post None.
+ */
+template <typename Key>
+double ChebyshevMetric::toDistance(Key key)
+{
+    return static_cast<double>(key);
+}
+
+/*
+ * @brief Constructor for WeightedLpMetric class.
+ * @param weights The weight of every axis, optional with every weight 1 by default.
+ * @pre Every weight is positive.
+ * @post A WeightedLpMetric object is created with the specified weights.
+ */
+template <int Exponent, int Dimension>
+WeightedLpMetric<Exponent, Dimension>::WeightedLpMetric(const std::array<double, Dimension> &weights) : weights(weights) {}
+
+/*
+ * @brief Calculate the key term of one axis.
+ * @param difference The coordinate difference along the axis.
+ * @param axis The axis of the difference.
+ * @return The weight of the axis times the absolute difference to the power Exponent.
+ * @pre axis is a valid axis.
+ * @post None.
+ */
+template <int Exponent, int Dimension>
+double WeightedLpMetric<Exponent, Dimension>::calculateAxisKey(double difference, int axis) const
+{
+    // Repeated multiplication instead of pow, unrolled for the compile-time exponent
+    double magnitude = std::fabs(difference);
+    double power = magnitude;
+    for (int i = 1; i < Exponent; i++)
+    {
+        power *= magnitude;
+    }
+    return this->weights[axis] * power;
+}
+
+/*
+ * @brief Add the term of one more axis to a partial key.
+ * @param key The key of the axes so far.
+ * @param axisKey The term of the next axis.
+ * @return The sum of the two.
+ * @pre None.
+ * @post None.
+ */
+template <int Exponent, int Dimension>
+double WeightedLpMetric<Exponent, Dimension>::combineKeys(double key, double axisKey) const
+{
+    return key + axisKey;
+}
+
+/*
+ * @brief Convert a key into a distance.
+ * @param key The weighted sum of powers.
+ * @return The Exponent-th root of the key.
+ * @pre key is non-negative.
+ * @post None.
+ */
+template <int Exponent, int Dimension>
+double WeightedLpMetric<Exponent, Dimension>::toDistance(double key)
+{
+    return std::pow(key, 1.0 / Exponent);
+}
+
+/*
+ * @brief Get a weight of 1 for every axis.
+ * @return The unit weights.
+ * @pre None.
+ * @post None.
+ */
+template <int Exponent, int Dimension>
+std::array<double, Dimension> WeightedLpMetric<Exponent, Dimension>::unitWeights()
+{
+    std::array<double, Dimension> weights;
+    weights.fill(1.0);
+    return weights;
+}
@@ -0,0 +1,402 @@
+/*
+ * @file DynamicClosestPair.cpp
+ * @brief Implementation of the DynamicClosestPair class for maintaining the closest pair under updates.
+ *
+ * This file contains the implementation of the DynamicClosestPair class. The structure keeps every pair
+ * of points no farther apart than the grid cell size in an ordered set; because the cell size never drops
+ * below the closest pair distance, the closest pair is always the first entry of the set. Inserting a point
+ * only inspects the 3 x 3 block of cells around it. On a rebuild the cell size is the median nearest
+ * neighbor distance, so the set holds at least a quarter as many pairs as there are points, and deleting or
+ * moving the closest points only removes entries. The set must lose all of those pairs before it empties
+ * and the nearest neighbors are measured again, which amortizes the O(n log n) rebuild over the updates.
+ * The copies of one location are chained in cell order by zero-distance pairs instead of pairing all of them.
+ * When insertions crowd the grid until the set holds many more pairs, it is rebuilt to keep cells sparse.
+ *
+ * @author Phat Tran
+ */
+
+#include "DynamicClosestPair.h"
+#include "AllNearestNeighbors.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+// A rebuild shrinks the cell size below the median nearest neighbor distance while it records more pairs per live point than this
+const double MAX_PAIRS_PER_POINT = 2.0;
+
+// Relative amount by which the cell size exceeds the distance it was measured from
+const double CELL_SLACK = 1e-9;
+
+/*
+ * @brief Constructor for DynamicClosestPair class.
+ * @param initialPoints The initial points, such as a PointSet; point i receives the identifier i.
+ * @pre None.
+ * @post The structure holds every point of the set and knows its closest pair.
+ */
+DynamicClosestPair::DynamicClosestPair(const PointSpan &initialPoints)
+    : cellSize(0.0), builtPairs(0), liveCount(initialPoints.size())
+{
+    for (size_t i = 0; i < initialPoints.size(); i++)
+    {
+        this->points.push_back(Point(initialPoints.getX(i), initialPoints.getY(i), static_cast<int>(i)));
+    }
+    this->alive.assign(this->points.size(), true);
+    this->partners.resize(this->points.size());
+
+    // Seed the grid from the nearest neighbor distances
+    restoreCellSize();
+}
+
+/*
+ * @brief Destructor for DynamicClosestPair class.
+ * @pre None.
+ * @post The DynamicClosestPair object and its associated resources are deallocated.
+ */
+DynamicClosestPair::~DynamicClosestPair() {}
+
+/*
+ * @brief Insert a new point.
+ * @param point The point to insert.
+ * @return The identifier assigned to the point.
+ * @pre None.
+ * @post The point is part of the structure and the closest pair is up to date.
+ */
+int DynamicClosestPair::insertPoint(const Point &point)
+{
+    int id = static_cast<int>(this->points.size());
+    this->points.push_back(Point(point.getX(), point.getY(), id));
+    this->alive.push_back(true);
+    this->partners.push_back(vector<int>());
+    this->liveCount++;
+
+    // The grid does not exist until there are two points to measure
+    if (this->cellSize > 0.0)
+    {
+        addToGrid(id);
+    }
+    restoreCellSize();
+
+    return id;
+}
+
+/*
+ * @brief Delete a point.
+ * @param id The identifier of the point to delete.
+ * @return True if the point existed and was deleted, false otherwise.
+ * @pre None.
+ * @post The point is no longer part of the structure and the closest pair is up to date.
+ */
+bool DynamicClosestPair::deletePoint(int id)
+{
+    if (id < 0 || id >= static_cast<int>(this->points.size()) || !this->alive[id])
+    {
+        return false;
+    }
+
+    if (this->cellSize > 0.0)
+    {
+        removeFromGrid(id);
+    }
+    this->alive[id] = false;
+    this->liveCount--;
+    restoreCellSize();
+
+    return true;
+}
+
+/*
+ * @brief Move a point to new coordinates, keeping its identifier.
+ * @param id The identifier of the point to move.
+ * @param x The new x-coordinate.
+ * @param y The new y-coordinate.
+ * @return True if the point existed and was moved, false otherwise.
+ * @pre None.
+ * @post The point has the new coordinates and the closest pair is up to date.
+ */
+bool DynamicClosestPair::movePoint(int id, double x, double y)
+{
+    if (id < 0 || id >= static_cast<int>(this->points.size()) || !this->alive[id])
+    {
+        return false;
+    }
+
+    if (this->cellSize > 0.0)
+    {
+        removeFromGrid(id);
+        this->points[id] = Point(x, y, id);
+        addToGrid(id);
+    }
+    else
+    {
+        this->points[id] = Point(x, y, id);
+    }
+    restoreCellSize();
+
+    return true;
+}
+
+/*
+ * @brief Get the current closest pair.
+ * @return The closest pair, identified by point identifiers, or an empty pair if fewer than two points remain.
+ * @pre None.
+ * @post The current closest pair is returned.
+ */
+PointPair DynamicClosestPair::getClosestPair() const
+{
+    if (this->nearPairs.empty())
+    {
+        return PointPair();
+    }
+    return *this->nearPairs.begin();
+}
+
+/*
+ * @brief Get the number of points currently in the structure.
+ * @return The number of live points.
+ * @pre None.
+ * @post The number of live points is returned.
+ */
+size_t DynamicClosestPair::size() const
+{
+    return this->liveCount;
+}
+
+/*
+ * @brief Orders pairs by distance, breaking ties by their indices so that every pair is a distinct key.
+ */
+bool DynamicClosestPair::PairOrder::operator()(const PointPair &a, const PointPair &b) const
+{
+    if (a.getDistance() != b.getDistance())
+    {
+        return a.getDistance() < b.getDistance();
+    }
+    if (a.getFirstIndex() != b.getFirstIndex())
+    {
+        return a.getFirstIndex() < b.getFirstIndex();
+    }
+    return a.getSecondIndex() < b.getSecondIndex();
+}
+
+/*
+ * @brief Hash function for grid cell coordinates.
+ */
+size_t DynamicClosestPair::CellHash::operator()(const pair<long long, long long> &cell) const
+{
+    return hash<long long>()(cell.first * 73856093LL ^ cell.second * 19349663LL);
+}
+
+/*
+ * @brief Get the grid cell containing a point.
+ * @param point The point.
+ * @return The cell coordinates of the point for the current cell size.
+ * @pre The cell size is positive.
+ * @post None.
+ */
+pair<long long, long long> DynamicClosestPair::getCell(const Point &point) const
+{
+    return make_pair(static_cast<long long>(floor(point.getX() / this->cellSize)),
+                     static_cast<long long>(floor(point.getY() / this->cellSize)));
+}
+
+/*
+ * @brief Add a live point to the grid and record its pairs with nearby points.
+ * @param id The identifier of the point.
+ * @pre The point is marked alive and is not yet in the grid.
+ * @post The point is in the grid and every pair within the cell size involving it is recorded, except that it is
+ *       paired with only the previous copy of its location in its cell.
+ */
+void DynamicClosestPair::addToGrid(int id)
+{
+    pair<long long, long long> cell = getCell(this->points[id]);
+    int lastCopy = -1;
+
+    // Any point within cellSize lies in one of the 3 x 3 cells around this one
+    for (long long dx = -1; dx <= 1; dx++)
+    {
+        for (long long dy = -1; dy <= 1; dy++)
+        {
+            unordered_map<pair<long long, long long>, vector<int>, CellHash>::const_iterator it =
+                this->grid.find(make_pair(cell.first + dx, cell.second + dy));
+            if (it == this->grid.end())
+            {
+                continue;
+            }
+
+            for (int other : it->second)
+            {
+                // Copies of the location are linked below, to the most recent one only
+                double distance = Point::calculateDistance(this->points[id], this->points[other]);
+                if (distance == 0.0)
+                {
+                    lastCopy = other;
+                    continue;
+                }
+                if (distance <= this->cellSize)
+                {
+                    this->nearPairs.insert(PointPair(id, other, distance));
+                    this->partners[id].push_back(other);
+                    this->partners[other].push_back(id);
+                }
+            }
+        }
+    }
+
+    // Copies share a cell, so chaining each to the previous one in the cell keeps k copies at k - 1 pairs
+    if (lastCopy >= 0)
+    {
+        this->nearPairs.insert(PointPair(id, lastCopy, 0.0));
+        this->partners[id].push_back(lastCopy);
+        this->partners[lastCopy].push_back(id);
+    }
+
+    this->grid[cell].push_back(id);
+}
+
+/*
+ * @brief Remove a point from the grid and forget its recorded pairs.
+ * @param id The identifier of the point.
+ * @pre The point is in the grid.
+ * @post The point and all pairs involving it are removed, and the other copies of its location are still linked.
+ */
+void DynamicClosestPair::removeFromGrid(int id)
+{
+    // Forget every recorded pair involving the point, remembering its neighbors in the chain of copies
+    vector<int> copies;
+    for (int other : this->partners[id])
+    {
+        double distance = Point::calculateDistance(this->points[id], this->points[other]);
+        this->nearPairs.erase(PointPair(id, other, distance));
+        vector<int> &otherPartners = this->partners[other];
+        otherPartners.erase(find(otherPartners.begin(), otherPartners.end(), id));
+        if (distance == 0.0)
+        {
+            copies.push_back(other);
+        }
+    }
+    this->partners[id].clear();
+
+    // The point was between at most two copies in the chain; join them so the chain stays whole
+    if (copies.size() == 2)
+    {
+        this->nearPairs.insert(PointPair(copies[0], copies[1], 0.0));
+        this->partners[copies[0]].push_back(copies[1]);
+        this->partners[copies[1]].push_back(copies[0]);
+    }
+
+    // Remove the point from its cell, dropping the cell once it is empty
+    pair<long long, long long> cell = getCell(this->points[id]);
+    vector<int> &bucket = this->grid[cell];
+    bucket.erase(find(bucket.begin(), bucket.end(), id));
+    if (bucket.empty())
+    {
+        this->grid.erase(cell);
+    }
+}
+
+/*
+ * @brief Rebuild the grid for a new cell size.
+ * @param newCellSize The new cell size, which must be at least the closest pair distance.
+ * @param maxPairs The number of recorded pairs at which to give up.
+ * @return True if the grid was rebuilt, false if it would record more than maxPairs pairs.
+ * @pre newCellSize is positive.
+ * @post On success, the grid and recorded pairs reflect every live point for the new cell size; otherwise they
+ *       are incomplete and the grid must be rebuilt again.
+ */
+bool DynamicClosestPair::rebuild(double newCellSize, size_t maxPairs)
+{
+    this->cellSize = newCellSize;
+    this->grid.clear();
+    this->nearPairs.clear();
+    for (vector<int> &list : this->partners)
+    {
+        list.clear();
+    }
+
+    for (int id = 0; id < static_cast<int>(this->points.size()); id++)
+    {
+        if (this->alive[id])
+        {
+            addToGrid(id);
+            if (this->nearPairs.size() > maxPairs)
+            {
+                return false;
+            }
+        }
+    }
+    this->builtPairs = this->nearPairs.size();
+    return true;
+}
+
+/*
+ * @brief Restore the structure after an update may have invalidated the cell size.
+ * @pre None.
+ * @post The cell size is at least the closest pair distance, and the recorded pairs are neither gone nor far
+ *       more than after the last rebuild.
+ */
+void DynamicClosestPair::restoreCellSize()
+{
+    if (this->liveCount < 2)
+    {
+        return;
+    }
+
+    // While any pair is recorded the closest pair is within the cell size, so it is already recorded
+    size_t maxPairs = static_cast<size_t>(MAX_PAIRS_PER_POINT * this->liveCount);
+    if (this->cellSize > 0.0 && !this->nearPairs.empty() && this->nearPairs.size() <= max(2 * this->builtPairs, maxPairs))
+    {
+        return;
+    }
+
+    // Measure the nearest neighbor distance of every live point, with the same function that filters the pairs
+    vector<int> ids;
+    vector<double> xs, ys;
+    for (size_t id = 0; id < this->points.size(); id++)
+    {
+        if (this->alive[id])
+        {
+            ids.push_back(static_cast<int>(id));
+            xs.push_back(this->points[id].getX());
+            ys.push_back(this->points[id].getY());
+        }
+    }
+    vector<int> neighbors = AllNearestNeighbors::findAllNearestNeighbors(PointSpan(xs.data(), ys.data(), xs.size()));
+    vector<double> distances(xs.size());
+    for (size_t i = 0; i < xs.size(); i++)
+    {
+        distances[i] = Point::calculateDistance(this->points[ids[i]], this->points[ids[neighbors[i]]]);
+    }
+
+    // More than half of the points have a neighbor within the median distance, so at least a quarter as many pairs are recorded
+    size_t middle = distances.size() / 2;
+    nth_element(distances.begin(), distances.begin() + middle, distances.end());
+    double newCellSize = distances[middle];
+    double minDistance = *min_element(distances.begin(), distances.begin() + middle + 1);
+
+    // Duplicate points leave no distance to size cells by; fall back to the average spacing
+    if (newCellSize == 0.0)
+    {
+        double minX = *min_element(xs.begin(), xs.end()), maxX = *max_element(xs.begin(), xs.end());
+        double minY = *min_element(ys.begin(), ys.end()), maxY = *max_element(ys.begin(), ys.end());
+        newCellSize = max(maxX - minX, maxY - minY) / sqrt(static_cast<double>(this->liveCount));
+        if (newCellSize == 0.0)
+        {
+            newCellSize = 1.0;
+        }
+    }
+    if (minDistance == 0.0)
+    {
+        minDistance = newCellSize;
+    }
+
+    // Widen the cells slightly, so that rounding in getCell cannot push a pair at the boundary out of the 3 x 3 block
+    newCellSize *= 1.0 + CELL_SLACK;
+    minDistance *= 1.0 + CELL_SLACK;
+
+    // Dense clusters can hold far more pairs within that distance; shrink towards the closest pair until they fit
+    while (!rebuild(newCellSize, (newCellSize > minDistance) ? maxPairs : numeric_limits<size_t>::max()))
+    {
+        newCellSize = max(newCellSize / 2.0, minDistance);
+    }
+}
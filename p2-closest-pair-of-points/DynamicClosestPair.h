@@ -0,0 +1,161 @@
+/*
+ * @file DynamicClosestPair.h
+ * @brief Declaration of the DynamicClosestPair class for maintaining the closest pair under updates.
+ *
+ * This file contains the declaration of the DynamicClosestPair class, which keeps the closest pair of a
+ * changing set of points up to date as points are inserted, deleted and moved. Points are bucketed in a
+ * uniform grid whose cell size is at least the current closest pair distance, and every pair of points
+ * no farther apart than the cell size is kept in an ordered set. The cell size leaves enough slack that
+ * the set holds a constant fraction of the points as pairs. The closest pair is always the first entry of
+ * that set, so it can be reported after every update without rerunning the static algorithm.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include "PointSpan.h"
+#include "PointPair.h"
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * @brief Class representing a closest pair structure that supports inserts, deletes and moves.
+ */
+class DynamicClosestPair
+{
+public:
+    /*
+     * @brief Constructor for DynamicClosestPair class.
+     * @param initialPoints The initial points, such as a PointSet; point i receives the identifier i.
+     * @pre None.
+     * @post The structure holds every point of the set and knows its closest pair.
+     */
+    explicit DynamicClosestPair(const PointSpan &initialPoints);
+
+    /*
+     * @brief Destructor for DynamicClosestPair class.
+     * @pre None.
+     * @post The DynamicClosestPair object and its associated resources are deallocated.
+     */
+    ~DynamicClosestPair();
+
+    /*
+     * @brief Insert a new point.
+     * @param point The point to insert.
+     * @return The identifier assigned to the point.
+     * @pre None.
+     * @post The point is part of the structure and the closest pair is up to date.
+     */
+    int insertPoint(const Point &point);
+
+    /*
+     * @brief Delete a point.
+     * @param id The identifier of the point to delete.
+     * @return True if the point existed and was deleted, false otherwise.
+     * @pre None.
+     * @post The point is no longer part of the structure and the closest pair is up to date.
+     */
+    bool deletePoint(int id);
+
+    /*
+     * @brief Move a point to new coordinates, keeping its identifier.
+     * @param id The identifier of the point to move.
+     * @param x The new x-coordinate.
+     * @param y The new y-coordinate.
+     * @return True if the point existed and was moved, false otherwise.
+     * @pre None.
+     * @post The point has the new coordinates and the closest pair is up to date.
+     */
+    bool movePoint(int id, double x, double y);
+
+    /*
+     * @brief Get the current closest pair.
+     * @return The closest pair, identified by point identifiers, or an empty pair if fewer than two points remain.
+     * @pre None.
+     * @post The current closest pair is returned.
+     */
+    PointPair getClosestPair() const;
+
+    /*
+     * @brief Get the number of points currently in the structure.
+     * @return The number of live points.
+     * @pre None.
+     * @post The number of live points is returned.
+     */
+    size_t size() const;
+
+private:
+    /*
+     * @brief Orders pairs by distance, breaking ties by their indices so that every pair is a distinct key.
+     */
+    struct PairOrder
+    {
+        bool operator()(const PointPair &a, const PointPair &b) const;
+    };
+
+    /*
+     * @brief Hash function for grid cell coordinates.
+     */
+    struct CellHash
+    {
+        size_t operator()(const std::pair<long long, long long> &cell) const;
+    };
+
+    /*
+     * @brief Get the grid cell containing a point.
+     * @param point The point.
+     * @return The cell coordinates of the point for the current cell size.
+     * @pre The cell size is positive.
+     * @post None.
+     */
+    std::pair<long long, long long> getCell(const Point &point) const;
+
+    /*
+     * @brief Add a live point to the grid and record its pairs with nearby points.
+     * @param id The identifier of the point.
+     * @pre The point is marked alive and is not yet in the grid.
+     * @post The point is in the grid and every pair within the cell size involving it is recorded, except that it is
+     *       paired with only the previous copy of its location in its cell.
+     */
+    void addToGrid(int id);
+
+    /*
+     * @brief Remove a point from the grid and forget its recorded pairs.
+     * @param id The identifier of the point.
+     * @pre The point is in the grid.
+     * @post The point and all pairs involving it are removed, and the other copies of its location are still linked.
+     */
+    void removeFromGrid(int id);
+
+    /*
+     * @brief Rebuild the grid for a new cell size.
+     * @param newCellSize The new cell size, which must be at least the closest pair distance.
+     * @param maxPairs The number of recorded pairs at which to give up.
+     * @return True if the grid was rebuilt, false if it would record more than maxPairs pairs.
+     * @pre newCellSize is positive.
+     * @post On success, the grid and recorded pairs reflect every live point for the new cell size; otherwise they
+     *       are incomplete and the grid must be rebuilt again.
+     */
+    bool rebuild(double newCellSize, size_t maxPairs);
+
+    /*
+     * @brief Restore the structure after an update may have invalidated the cell size.
+     * @pre None.
+     * @post The cell size is at least the closest pair distance, and the recorded pairs are neither gone nor far
+     *       more than after the last rebuild.
+     */
+    void restoreCellSize();
+
+    std::vector<Point> points;                 // Points by identifier.
+    std::vector<bool> alive;                   // Whether each identifier is still present.
+    std::vector<std::vector<int>> partners;    // Identifiers paired with each point in nearPairs.
+    std::set<PointPair, PairOrder> nearPairs;  // Pairs of live points within cellSize, chaining the copies of a location.
+    std::unordered_map<std::pair<long long, long long>, std::vector<int>, CellHash> grid; // Identifiers bucketed by cell.
+    double cellSize;                           // Side length of a grid cell.
+    size_t builtPairs;                         // Number of recorded pairs right after the last rebuild.
+    size_t liveCount;                          // Number of live points.
+};
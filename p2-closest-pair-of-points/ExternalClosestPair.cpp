@@ -0,0 +1,452 @@
+/*
+ * @file ExternalClosestPair.cpp
+ * @brief Implementation of the ExternalClosestPair class for finding the closest pair of points that do not fit in memory.
+ *
+ * This file contains the implementation of the ExternalClosestPair class. The memory budget is shared
+ * between the two run buffers while the input is split into runs, and between the merge buffers, two slabs
+ * and the strip while the merged stream is solved. In both phases one buffer is filled while the other is
+ * being processed on a separate thread. The strip holds, in y-order, the points within the current closest
+ * distance of the next point of the stream in x: any point further left is farther than that distance from
+ * every later point. The pairs within a slab are solved by the in-memory algorithm, and the pairs between
+ * the strip and the slab by a sweep in y-order. Both sides of the sweep are at least the closest distance
+ * apart among themselves, so each strip point is compared with a constant number of slab points, and the
+ * reported distance is exactly the in-memory one.
+ *
+ * @author Phat Tran
+ */
+
+#include "ExternalClosestPair.h"
+#include "ClosestPairAlgorithm.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <limits>
+
+using namespace std;
+
+// Smallest number of records read from a run at a time, so that reads stay large and sequential, and smallest strip capacity
+const size_t MIN_BLOCK_RECORDS = 1024;
+
+/*
+ * @brief Find the closest pair of the points in a file, using a bounded amount of memory.
+ * @param inputPath The input file, in the format of program2data.txt: the number of points, then the x- and y-coordinate of each point.
+ * @param tempDirectory The directory in which to create a private subdirectory for the temporary run files.
+ * @param memoryBudget The approximate number of bytes of point data to hold in memory at once.
+ * @param firstIndex Receives the position of the pair's first point in the file, or -1 on error.
+ * @param secondIndex Receives the position of the pair's second point in the file, or -1 on error.
+ * @return The distance between the closest pair, which is identical to that of the in-memory algorithm, or the maximum possible distance on error.
+ * @pre The input file holds at least two points and the temporary directory is writable. The points within the
+ *      closest distance of any one x-coordinate fit in an eighth of the memory budget; otherwise an error is reported.
+ * @post The closest pair is reported, and the temporary directory created for the run files is removed with them.
+ */
+double ExternalClosestPair::findClosestPair(const string &inputPath, const string &tempDirectory, size_t memoryBudget,
+                                            long long &firstIndex, long long &secondIndex)
+{
+    firstIndex = -1;
+    secondIndex = -1;
+
+    ifstream input(inputPath);
+    if (!input.is_open())
+    {
+        cerr << "Error: Cannot open the input file." << endl;
+        return numeric_limits<double>::max();
+    }
+    long long count = 0;
+    input >> count;
+    if (!input || count < 2)
+    {
+        cerr << "Error: The closest pair algorithm requires at least two points for accurate computation." << endl;
+        return numeric_limits<double>::max();
+    }
+
+    // Give this search its own directory, so that concurrent searches in the same temporary directory never share run files
+    string runTemplate = tempDirectory + "/closest_pair_XXXXXX";
+    vector<char> runDirectory(runTemplate.begin(), runTemplate.end());
+    runDirectory.push_back('\0');
+    if (mkdtemp(runDirectory.data()) == nullptr)
+    {
+        cerr << "Error: Could not create a temporary directory in " << tempDirectory << "." << endl;
+        return numeric_limits<double>::max();
+    }
+
+    // Phase 1: two run buffers share the budget
+    size_t budgetRecords = max(memoryBudget / sizeof(Record), static_cast<size_t>(16));
+    vector<string> runPaths;
+    bool succeeded = createRuns(input, count, runDirectory.data(), budgetRecords / 2, runPaths);
+    input.close();
+
+    // Phase 2: a quarter of the budget for the merge buffers, an eighth for each of two slabs and the strip, the rest for the solvers
+    MergeState state;
+    if (succeeded)
+    {
+        size_t blockRecords = max(budgetRecords / (4 * runPaths.size()), MIN_BLOCK_RECORDS);
+        succeeded = openMerge(runPaths, blockRecords, state);
+    }
+
+    double bestDistance = numeric_limits<double>::max();
+    if (succeeded)
+    {
+        size_t slabRecords = max(budgetRecords / 8, static_cast<size_t>(2));
+        size_t stripRecords = max(budgetRecords / 8, MIN_BLOCK_RECORDS);
+        vector<Record> currentSlab, nextSlab, strip;
+        readMerged(state, currentSlab, slabRecords);
+        while (!currentSlab.empty())
+        {
+            // Read the next slab while solving this one
+            future<size_t> nextRead = async(launch::async, readMerged, ref(state), ref(nextSlab), slabRecords);
+
+            // Solve the pairs within the slab, then the pairs between the strip and the slab
+            solveSlab(currentSlab, bestDistance, firstIndex, secondIndex);
+            sweepStrip(strip, currentSlab, bestDistance, firstIndex, secondIndex);
+
+            // The first point of the next slab comes before every later point, so its x-coordinate bounds them all
+            if (nextRead.get() == 0)
+            {
+                break;
+            }
+            updateStrip(strip, currentSlab, nextSlab.front().x, bestDistance);
+            if (strip.size() > stripRecords)
+            {
+                cerr << "Error: " << strip.size() << " points lie within the closest distance of one x-coordinate, "
+                     << "more than the memory budget can hold; raise the budget." << endl;
+                succeeded = false;
+                break;
+            }
+            currentSlab.swap(nextSlab);
+        }
+    }
+
+    // Close and remove the temporary files and their directory
+    state.files.clear();
+    for (const string &path : runPaths)
+    {
+        remove(path.c_str());
+    }
+    remove(runDirectory.data());
+
+    if (!succeeded)
+    {
+        firstIndex = -1;
+        secondIndex = -1;
+        return numeric_limits<double>::max();
+    }
+    return bestDistance;
+}
+
+/*
+ * @brief Orders merge heap entries so that the smallest record is on top.
+ */
+bool ExternalClosestPair::HeapOrder::operator()(const pair<Record, int> &a, const pair<Record, int> &b) const
+{
+    return compareRecords(b.first, a.first);
+}
+
+/*
+ * @brief Read the input file and write it out as sorted runs.
+ * @param input The open input file, positioned after the number of points.
+ * @param count The number of points in the input file.
+ * @param runDirectory The directory in which to create the run files, used by this search alone.
+ * @param runRecords The number of records per run.
+ * @param runPaths Receives the paths of the run files, in order.
+ * @return True if every run was written, false otherwise.
+ * @pre runRecords is positive.
+ * @post Every point of the input is in exactly one run file, and each run file is sorted.
+ */
+bool ExternalClosestPair::createRuns(ifstream &input, long long count, const string &runDirectory, size_t runRecords,
+                                     vector<string> &runPaths)
+{
+    vector<Record> filling, writing;
+    future<bool> pendingWrite;
+    long long readCount = 0;
+    while (readCount < count)
+    {
+        // Parse the next run while the previous one is sorted and written
+        filling.clear();
+        while (filling.size() < runRecords && readCount < count)
+        {
+            Record record;
+            input >> record.x >> record.y;
+            if (!input)
+            {
+                cerr << "Error: The input file ended before all points were read." << endl;
+                if (pendingWrite.valid())
+                {
+                    pendingWrite.get();
+                }
+                return false;
+            }
+            record.index = readCount++;
+            filling.push_back(record);
+        }
+
+        if (pendingWrite.valid() && !pendingWrite.get())
+        {
+            return false;
+        }
+        filling.swap(writing);
+        runPaths.push_back(runDirectory + "/run_" + to_string(runPaths.size()) + ".bin");
+        pendingWrite = async(launch::async, writeRun, ref(writing), runPaths.back());
+    }
+
+    return !pendingWrite.valid() || pendingWrite.get();
+}
+
+/*
+ * @brief Sort a block of records and write it to a run file.
+ * @param records The records of the run, sorted in place.
+ * @param path The path of the run file.
+ * @return True if the file was written, false otherwise.
+ * @pre None.
+ * @post The run file holds the records in sorted order.
+ */
+bool ExternalClosestPair::writeRun(vector<Record> &records, const string &path)
+{
+    sort(records.begin(), records.end(), compareRecords);
+
+    ofstream file(path, ios::binary);
+    file.write(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(Record));
+    if (!file)
+    {
+        cerr << "Error: Could not write the temporary file " << path << "." << endl;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * @brief Open every run and prepare the k-way merge.
+ * @param runPaths The paths of the run files.
+ * @param blockRecords The number of records to read from a run at a time.
+ * @param state Receives the merge state.
+ * @return True if every run could be opened, false otherwise.
+ * @pre blockRecords is positive.
+ * @post The heap holds the first record of every non-empty run.
+ */
+bool ExternalClosestPair::openMerge(const vector<string> &runPaths, size_t blockRecords, MergeState &state)
+{
+    state.blockRecords = blockRecords;
+    state.buffers.resize(runPaths.size());
+    state.positions.assign(runPaths.size(), 0);
+    for (int run = 0; run < static_cast<int>(runPaths.size()); run++)
+    {
+        state.files.emplace_back(runPaths[run], ios::binary);
+        if (!state.files.back().is_open())
+        {
+            cerr << "Error: Could not open the temporary file " << runPaths[run] << "." << endl;
+            return false;
+        }
+        if (refillRun(state, run))
+        {
+            state.heap.push(make_pair(state.buffers[run][state.positions[run]++], run));
+        }
+    }
+    return true;
+}
+
+/*
+ * @brief Read the next records of the merged stream.
+ * @param state The merge state.
+ * @param slab Receives up to maxRecords records, in sorted order.
+ * @param maxRecords The maximum number of records to read.
+ * @return The number of records read, which is 0 once the stream is exhausted.
+ * @pre The merge state was prepared by openMerge.
+ * @post The records are removed from the merge.
+ */
+size_t ExternalClosestPair::readMerged(MergeState &state, vector<Record> &slab, size_t maxRecords)
+{
+    slab.clear();
+    while (slab.size() < maxRecords && !state.heap.empty())
+    {
+        // Take the smallest head, then replace it with the next record of the same run
+        int run = state.heap.top().second;
+        slab.push_back(state.heap.top().first);
+        state.heap.pop();
+
+        if (state.positions[run] == state.buffers[run].size() && !refillRun(state, run))
+        {
+            continue;
+        }
+        state.heap.push(make_pair(state.buffers[run][state.positions[run]++], run));
+    }
+    return slab.size();
+}
+
+/*
+ * @brief Read the next block of a run into its buffer.
+ * @param state The merge state.
+ * @param run The run to refill.
+ * @return True if at least one record was read, false once the run is exhausted.
+ * @pre The run's buffer has been consumed.
+ * @post The run's buffer holds its next block.
+ */
+bool ExternalClosestPair::refillRun(MergeState &state, int run)
+{
+    vector<Record> &buffer = state.buffers[run];
+    buffer.resize(state.blockRecords);
+    state.files[run].read(reinterpret_cast<char *>(buffer.data()), buffer.size() * sizeof(Record));
+    buffer.resize(static_cast<size_t>(state.files[run].gcount()) / sizeof(Record));
+    state.positions[run] = 0;
+    return !buffer.empty();
+}
+
+/*
+ * @brief Find the closest pair among records sorted by x-coordinate and update the best pair.
+ * @param records The records, sorted by x-coordinate.
+ * @param bestDistance The distance of the closest pair found so far.
+ * @param firstIndex The input position of the first point of the closest pair found so far.
+ * @param secondIndex The input position of the second point of the closest pair found so far.
+ * @pre None.
+ * @post The best pair accounts for every pair of the records.
+ */
+void ExternalClosestPair::solveSlab(const vector<Record> &records, double &bestDistance, long long &firstIndex, long long &secondIndex)
+{
+    if (records.size() < 2)
+    {
+        return;
+    }
+
+    // Points are tagged with their position in the slab, which maps back to the input position
+    PointSet sortedPointsX;
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        sortedPointsX.addPoint(Point(records[i].x, records[i].y, static_cast<int>(i)));
+    }
+    PointPair closestPair = ClosestPairAlgorithm::findClosestPairPresorted(sortedPointsX);
+    if (closestPair.getDistance() < bestDistance)
+    {
+        bestDistance = closestPair.getDistance();
+        firstIndex = min(records[closestPair.getFirstIndex()].index, records[closestPair.getSecondIndex()].index);
+        secondIndex = max(records[closestPair.getFirstIndex()].index, records[closestPair.getSecondIndex()].index);
+    }
+}
+
+/*
+ * @brief Compare every strip point with the slab points that can be closer than the best distance, and update the best pair.
+ * @param strip The points carried over from earlier slabs, sorted by y-coordinate.
+ * @param slab The points of the slab, sorted by x-coordinate, all to the right of the strip.
+ * @param bestDistance The distance of the closest pair found so far, at most the closest distance within the slab.
+ * @param firstIndex The input position of the first point of the closest pair found so far.
+ * @param secondIndex The input position of the second point of the closest pair found so far.
+ * @pre Every strip point comes before every slab point in x-order.
+ * @post The best pair accounts for every pair of a strip point and a slab point.
+ */
+void ExternalClosestPair::sweepStrip(const vector<Record> &strip, const vector<Record> &slab, double &bestDistance,
+                                     long long &firstIndex, long long &secondIndex)
+{
+    if (strip.empty())
+    {
+        return;
+    }
+
+    // Only the slab points within the best distance of the strip's rightmost x-coordinate can pair with the strip
+    double stripMaxX = strip[0].x;
+    for (const Record &record : strip)
+    {
+        stripMaxX = max(stripMaxX, record.x);
+    }
+    vector<Record> candidates;
+    for (size_t i = 0; i < slab.size() && slab[i].x - stripMaxX < bestDistance; i++)
+    {
+        candidates.push_back(slab[i]);
+    }
+    sort(candidates.begin(), candidates.end(), compareRecordsY);
+
+    // Walk both sides in y-order, comparing each strip point with the candidates in its y-window
+    size_t low = 0;
+    for (const Record &point : strip)
+    {
+        while (low < candidates.size() && candidates[low].y <= point.y - bestDistance)
+        {
+            low++;
+        }
+        for (size_t j = low; j < candidates.size() && candidates[j].y - point.y < bestDistance; j++)
+        {
+            double dx = point.x - candidates[j].x;
+            double dy = point.y - candidates[j].y;
+            double distance = sqrt(dx * dx + dy * dy);
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                firstIndex = min(point.index, candidates[j].index);
+                secondIndex = max(point.index, candidates[j].index);
+            }
+        }
+    }
+}
+
+/*
+ * @brief Add a solved slab to the strip and drop the points that can no longer be closer than the best distance to a later point.
+ * @param strip The strip, sorted by y-coordinate; replaced by the new strip.
+ * @param slab The solved slab, sorted by x-coordinate.
+ * @param nextX The x-coordinate of the next point of the stream, which no later point is left of.
+ * @param bestDistance The distance of the closest pair found so far.
+ * @pre Every point of the strip and the slab comes before the next point of the stream.
+ * @post The strip holds, in y-order, every point of the old strip and the slab within bestDistance of nextX.
+ */
+void ExternalClosestPair::updateStrip(vector<Record> &strip, const vector<Record> &slab, double nextX, double bestDistance)
+{
+    // The slab is in x-order, so the points it keeps form a suffix
+    size_t keepFrom = slab.size();
+    while (keepFrom > 0 && nextX - slab[keepFrom - 1].x < bestDistance)
+    {
+        keepFrom--;
+    }
+    vector<Record> kept(slab.begin() + keepFrom, slab.end());
+    sort(kept.begin(), kept.end(), compareRecordsY);
+
+    // Merge the surviving strip points with the kept slab points in y-order
+    vector<Record> merged;
+    size_t j = 0;
+    for (const Record &record : strip)
+    {
+        if (nextX - record.x >= bestDistance)
+        {
+            continue;
+        }
+        while (j < kept.size() && compareRecordsY(kept[j], record))
+        {
+            merged.push_back(kept[j++]);
+        }
+        merged.push_back(record);
+    }
+    merged.insert(merged.end(), kept.begin() + j, kept.end());
+    strip.swap(merged);
+}
+
+/*
+ * @brief Order records by x-coordinate, then y-coordinate, then input position.
+ * @param a The first record.
+ * @param b The second record.
+ * @return True if a comes before b.
+ * @pre None.
+ * @post None.
+ */
+bool ExternalClosestPair::compareRecords(const Record &a, const Record &b)
+{
+    if (a.x != b.x)
+    {
+        return a.x < b.x;
+    }
+    return (a.y != b.y) ? a.y < b.y : a.index < b.index;
+}
+
+/*
+ * @brief Order records by y-coordinate, then x-coordinate, then input position.
+ * @param a The first record.
+ * @param b The second record.
+ * @return True if a comes before b.
+ * @pre None.
+ * @post None.
+ */
+bool ExternalClosestPair::compareRecordsY(const Record &a, const Record &b)
+{
+    if (a.y != b.y)
+    {
+        return a.y < b.y;
+    }
+    return (a.x != b.x) ? a.x < b.x : a.index < b.index;
+}
@@ -0,0 +1,188 @@
+/*
+ * @file ExternalClosestPair.h
+ * @brief Declaration of the ExternalClosestPair class for finding the closest pair of points that do not fit in memory.
+ *
+ * This file contains the declaration of the ExternalClosestPair class, which finds the closest pair of a
+ * point file without ever holding all of its points. The points are sorted by x-coordinate externally: the
+ * file is cut into runs that are sorted in memory and written to temporary files, and the runs are merged
+ * back into one x-ordered stream. The stream is consumed in slabs, each solved with the in-memory
+ * ClosestPairAlgorithm and then swept against a strip of earlier points that lie within the current closest
+ * distance of the boundary. All file accesses are sequential, and the next block of input is read while
+ * the current one is processed.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * @brief Class representing an out-of-core algorithm to find the closest pair of points.
+ */
+class ExternalClosestPair
+{
+public:
+    /*
+     * @brief Find the closest pair of the points in a file, using a bounded amount of memory.
+     * @param inputPath The input file, in the format of program2data.txt: the number of points, then the x- and y-coordinate of each point.
+     * @param tempDirectory The directory in which to create a private subdirectory for the temporary run files.
+     * @param memoryBudget The approximate number of bytes of point data to hold in memory at once.
+     * @param firstIndex Receives the position of the pair's first point in the file, or -1 on error.
+     * @param secondIndex Receives the position of the pair's second point in the file, or -1 on error.
+     * @return The distance between the closest pair, which is identical to that of the in-memory algorithm, or the maximum possible distance on error.
+     * @pre The input file holds at least two points and the temporary directory is writable. The points within the
+     *      closest distance of any one x-coordinate fit in an eighth of the memory budget; otherwise an error is reported.
+     * @post The closest pair is reported, and the temporary directory created for the run files is removed with them.
+     */
+    static double findClosestPair(const std::string &inputPath, const std::string &tempDirectory, size_t memoryBudget,
+                                  long long &firstIndex, long long &secondIndex);
+
+private:
+    /*
+     * @brief A point as stored in the run files: its coordinates and its position in the input file.
+     */
+    struct Record
+    {
+        double x;        // x-coordinate.
+        double y;        // y-coordinate.
+        long long index; // Position of the point in the input file.
+    };
+
+    /*
+     * @brief Orders merge heap entries so that the smallest record is on top.
+     */
+    struct HeapOrder
+    {
+        bool operator()(const std::pair<Record, int> &a, const std::pair<Record, int> &b) const;
+    };
+
+    /*
+     * @brief The state of the k-way merge over the sorted runs.
+     */
+    struct MergeState
+    {
+        std::vector<std::ifstream> files;         // One open file per run.
+        std::vector<std::vector<Record>> buffers; // The block most recently read from each run.
+        std::vector<size_t> positions;            // The next unread record of each buffer.
+        std::priority_queue<std::pair<Record, int>, std::vector<std::pair<Record, int>>, HeapOrder>
+            heap;                                 // The head record of every unfinished run, smallest on top.
+        size_t blockRecords;                      // Number of records read from a run at a time.
+    };
+
+    /*
+     * @brief Read the input file and write it out as sorted runs.
+     * @param input The open input file, positioned after the number of points.
+     * @param count The number of points in the input file.
+     * @param runDirectory The directory in which to create the run files, used by this search alone.
+     * @param runRecords The number of records per run.
+     * @param runPaths Receives the paths of the run files, in order.
+     * @return True if every run was written, false otherwise.
+     * @pre runRecords is positive.
+     * @post Every point of the input is in exactly one run file, and each run file is sorted.
+     */
+    static bool createRuns(std::ifstream &input, long long count, const std::string &runDirectory, size_t runRecords,
+                           std::vector<std::string> &runPaths);
+
+    /*
+     * @brief Sort a block of records and write it to a run file.
+     * @param records The records of the run, sorted in place.
+     * @param path The path of the run file.
+     * @return True if the file was written, false otherwise.
+     * @pre None.
+     * @post The run file holds the records in sorted order.
+     */
+    static bool writeRun(std::vector<Record> &records, const std::string &path);
+
+    /*
+     * @brief Open every run and prepare the k-way merge.
+     * @param runPaths The paths of the run files.
+     * @param blockRecords The number of records to read from a run at a time.
+     * @param state Receives the merge state.
+     * @return True if every run could be opened, false otherwise.
+     * @pre blockRecords is positive.
+     * @post The heap holds the first record of every non-empty run.
+     */
+    static bool openMerge(const std::vector<std::string> &runPaths, size_t blockRecords, MergeState &state);
+
+    /*
+     * @brief Read the next records of the merged stream.
+     * @param state The merge state.
+     * @param slab Receives up to maxRecords records, in sorted order.
+     * @param maxRecords The maximum number of records to read.
+     * @return The number of records read, which is 0 once the stream is exhausted.
+     * @pre The merge state was prepared by openMerge.
+     * @post The records are removed from the merge.
+     */
+    static size_t readMerged(MergeState &state, std::vector<Record> &slab, size_t maxRecords);
+
+    /*
+     * @brief Read the next block of a run into its buffer.
+     * @param state The merge state.
+     * @param run The run to refill.
+     * @return True if at least one record was read, false once the run is exhausted.
+     * @pre The run's buffer has been consumed.
+     * @post The run's buffer holds its next block.
+     */
+    static bool refillRun(MergeState &state, int run);
+
+    /*
+     * @brief Find the closest pair among records sorted by x-coordinate and update the best pair.
+     * @param records The records, sorted by x-coordinate.
+     * @param bestDistance The distance of the closest pair found so far.
+     * @param firstIndex The input position of the first point of the closest pair found so far.
+     * @param secondIndex The input position of the second point of the closest pair found so far.
+     * @pre None.
+     * @post The best pair accounts for every pair of the records.
+     */
+    static void solveSlab(const std::vector<Record> &records, double &bestDistance, long long &firstIndex, long long &secondIndex);
+
+    /*
+     * @brief Compare every strip point with the slab points that can be closer than the best distance, and update the best pair.
+     * @param strip The points carried over from earlier slabs, sorted by y-coordinate.
+     * @param slab The points of the slab, sorted by x-coordinate, all to the right of the strip.
+     * @param bestDistance The distance of the closest pair found so far, at most the closest distance within the slab.
+     * @param firstIndex The input position of the first point of the closest pair found so far.
+     * @param secondIndex The input position of the second point of the closest pair found so far.
+     * @pre Every strip point comes before every slab point in x-order.
+     * @post The best pair accounts for every pair of a strip point and a slab point.
+     */
+    static void sweepStrip(const std::vector<Record> &strip, const std::vector<Record> &slab, double &bestDistance,
+                           long long &firstIndex, long long &secondIndex);
+
+    /*
+     * @brief Add a solved slab to the strip and drop the points that can no longer be closer than the best distance to a later point.
+     * @param strip The strip, sorted by y-coordinate; replaced by the new strip.
+     * @param slab The solved slab, sorted by x-coordinate.
+     * @param nextX The x-coordinate of the next point of the stream, which no later point is left of.
+     * @param bestDistance The distance of the closest pair found so far.
+     * @pre Every point of the strip and the slab comes before the next point of the stream.
+     * @post The strip holds, in y-order, every point of the old strip and the slab within bestDistance of nextX.
+     */
+    static void updateStrip(std::vector<Record> &strip, const std::vector<Record> &slab, double nextX, double bestDistance);
+
+    /*
+     * @brief Order records by x-coordinate, then y-coordinate, then input position.
+     * @param a The first record.
+     * @param b The second record.
+     * @return True if a comes before b.
+     * @pre None.
+     * @post None.
+     */
+    static bool compareRecords(const Record &a, const Record &b);
+
+    /*
+     * @brief Order records by y-coordinate, then x-coordinate, then input position.
+     * @param a The first record.
+     * @param b The second record.
+     * @return True if a comes before b.
+     * @pre None.
+     * @post None.
+     */
+    static bool compareRecordsY(const Record &a, const Record &b);
+};
@@ -0,0 +1,209 @@
+/*
+ * @file FixedRadiusNearPairs.cpp
+ * @brief Implementation of the FixedRadiusNearPairs class for reporting every pair of points within a radius.
+ *
+ * This file contains the implementation of the FixedRadiusNearPairs class. The points are sorted by grid
+ * row and then column and copied into separate coordinate arrays, so every cell is a contiguous range and
+ * the cells of one row appear in column order. Each cell is compared against itself, its right neighbor,
+ * and the three cells below it in the next row, which covers every adjacent pair of cells once. The inner
+ * loop compacts matches branch-free over contiguous arrays so the compiler can vectorize it. Grid rows are
+ * handed out to worker threads, each of which fills its own chunk and flushes it to the callback under a lock.
+ *
+ * @author Phat Tran
+ */
+
+#include "FixedRadiusNearPairs.h"
+#include "ParallelUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+/*
+ * @brief Report every pair of points at distance at most radius.
+ * @param points The points, such as a PointSet.
+ * @param radius The query radius.
+ * @param callback Receives the pairs in chunks, identified by their positions in the input.
+ * @param chunkSize The maximum number of pairs per callback invocation.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @return The total number of pairs reported.
+ * @pre radius is positive and chunkSize is positive.
+ * @post Every pair within radius has been passed to the callback exactly once.
+ */
+size_t FixedRadiusNearPairs::reportPairs(const PointSpan &points, double radius, const PairCallback &callback,
+                                         size_t chunkSize, int threadCount)
+{
+    if (radius <= 0.0 || chunkSize == 0)
+    {
+        cerr << "Error: The fixed-radius query requires a positive radius and chunk size." << endl;
+        return 0;
+    }
+
+    int size = static_cast<int>(points.size());
+    if (size < 2)
+    {
+        return 0;
+    }
+
+    // Compute the grid cell of every point relative to the bounding box
+    double minX = points.getX(0);
+    double minY = points.getY(0);
+    for (int i = 1; i < size; i++)
+    {
+        minX = min(minX, points.getX(i));
+        minY = min(minY, points.getY(i));
+    }
+    vector<long long> pointRows(size);
+    vector<long long> pointCols(size);
+    vector<int> order(size);
+    for (int i = 0; i < size; i++)
+    {
+        pointRows[i] = static_cast<long long>(floor((points.getY(i) - minY) / radius));
+        pointCols[i] = static_cast<long long>(floor((points.getX(i) - minX) / radius));
+        order[i] = i;
+    }
+
+    // Sort by row, then column, so that every cell is a contiguous range
+    sort(order.begin(), order.end(), [&pointRows, &pointCols](int a, int b)
+         { return (pointRows[a] != pointRows[b]) ? pointRows[a] < pointRows[b] : pointCols[a] < pointCols[b]; });
+
+    vector<double> xs(size), ys(size);
+    vector<long long> rows(size), cols(size);
+    vector<int> ids(size);
+    for (int i = 0; i < size; i++)
+    {
+        xs[i] = points.getX(order[i]);
+        ys[i] = points.getY(order[i]);
+        rows[i] = pointRows[order[i]];
+        cols[i] = pointCols[order[i]];
+        ids[i] = order[i];
+    }
+
+    // Record where each occupied row starts, with a sentinel at the end
+    vector<int> rowStarts;
+    for (int i = 0; i < size; i++)
+    {
+        if (i == 0 || rows[i] != rows[i - 1])
+        {
+            rowStarts.push_back(i);
+        }
+    }
+    int rowCount = static_cast<int>(rowStarts.size());
+    rowStarts.push_back(size);
+
+    const double squaredRadius = radius * radius;
+    atomic<int> nextRow(0);
+    atomic<size_t> totalPairs(0);
+    mutex callbackMutex;
+
+    // Each worker claims whole rows and compares every cell of the row with its neighbors
+    auto worker = [&]()
+    {
+        vector<PointPair> chunk;
+        vector<int> matches(size);
+        size_t reported = 0;
+
+        // Flush the chunk to the callback once it is full
+        auto emit = [&](int a, int b, double squaredDistance)
+        {
+            chunk.push_back(PointPair(ids[a], ids[b], sqrt(squaredDistance)));
+            reported++;
+            if (chunk.size() >= chunkSize)
+            {
+                lock_guard<mutex> lock(callbackMutex);
+                callback(chunk);
+                chunk.clear();
+            }
+        };
+
+        // Compare point i against the contiguous range [begin, end), compacting matches without branches
+        auto scanRange = [&](int i, int begin, int end)
+        {
+            int matchCount = 0;
+            const double x = xs[i], y = ys[i];
+            for (int j = begin; j < end; j++)
+            {
+                double dx = xs[j] - x;
+                double dy = ys[j] - y;
+                matches[matchCount] = j;
+                matchCount += (dx * dx + dy * dy <= squaredRadius) ? 1 : 0;
+            }
+            for (int m = 0; m < matchCount; m++)
+            {
+                int j = matches[m];
+                double dx = xs[j] - x;
+                double dy = ys[j] - y;
+                emit(i, j, dx * dx + dy * dy);
+            }
+        };
+
+        for (int row = nextRow++; row < rowCount; row = nextRow++)
+        {
+            int rowBegin = rowStarts[row];
+            int rowEnd = rowStarts[row + 1];
+
+            // The next occupied row only matters if it is the adjacent grid row
+            bool hasRowBelow = (row + 1 < rowCount) && (rows[rowStarts[row + 1]] == rows[rowBegin] + 1);
+            int belowBegin = hasRowBelow ? rowStarts[row + 1] : 0;
+            int belowEnd = hasRowBelow ? rowStarts[row + 2] : 0;
+
+            for (int cellBegin = rowBegin; cellBegin < rowEnd;)
+            {
+                long long col = cols[cellBegin];
+                int cellEnd = cellBegin;
+                while (cellEnd < rowEnd && cols[cellEnd] == col)
+                {
+                    cellEnd++;
+                }
+
+                // The right neighbor cell, if occupied, starts right after this one
+                int rightEnd = cellEnd;
+                while (rightEnd < rowEnd && cols[rightEnd] == col + 1)
+                {
+                    rightEnd++;
+                }
+
+                // Columns col - 1 to col + 1 of the row below form one contiguous range
+                int lowBegin = 0, lowEnd = 0;
+                if (hasRowBelow)
+                {
+                    lowBegin = static_cast<int>(lower_bound(cols.begin() + belowBegin, cols.begin() + belowEnd, col - 1) - cols.begin());
+                    lowEnd = static_cast<int>(upper_bound(cols.begin() + lowBegin, cols.begin() + belowEnd, col + 1) - cols.begin());
+                }
+
+                for (int i = cellBegin; i < cellEnd; i++)
+                {
+                    scanRange(i, i + 1, rightEnd);
+                    scanRange(i, lowBegin, lowEnd);
+                }
+
+                cellBegin = cellEnd;
+            }
+        }
+
+        // Flush whatever is left
+        if (!chunk.empty())
+        {
+            lock_guard<mutex> lock(callbackMutex);
+            callback(chunk);
+        }
+        totalPairs += reported;
+    };
+
+    int workerCount = ParallelUtils::resolveThreadCount(threadCount, rowCount);
+    vector<thread> workers;
+    for (int i = 0; i < workerCount; i++)
+    {
+        workers.push_back(thread(worker));
+    }
+    for (thread &thread : workers)
+    {
+        thread.join();
+    }
+
+    return totalPairs;
+}
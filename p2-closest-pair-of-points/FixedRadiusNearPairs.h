@@ -0,0 +1,43 @@
+/*
+ * @file FixedRadiusNearPairs.h
+ * @brief Declaration of the FixedRadiusNearPairs class for reporting every pair of points within a radius.
+ *
+ * This file contains the declaration of the FixedRadiusNearPairs class, which reports every pair of points
+ * of a PointSet at distance at most r. Points are bucketed in a uniform grid of cell size r, so each pair
+ * can only come from the same or an adjacent cell. Pairs are handed to a callback in chunks, so the full
+ * result never has to be held in memory.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include "PointSpan.h"
+#include "PointPair.h"
+#include <functional>
+#include <vector>
+
+/*
+ * @brief Class representing an algorithm to report every pair of points within a fixed radius.
+ */
+class FixedRadiusNearPairs
+{
+public:
+    // Receives a chunk of reported pairs; calls are serialized, so the callback needs no locking.
+    typedef std::function<void(const std::vector<PointPair> &)> PairCallback;
+
+    /*
+     * @brief Report every pair of points at distance at most radius.
+     * @param points The points, such as a PointSet.
+     * @param radius The query radius.
+     * @param callback Receives the pairs in chunks, identified by their positions in the input.
+     * @param chunkSize The maximum number of pairs per callback invocation.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @return The total number of pairs reported.
+     * @pre radius is positive and chunkSize is positive.
+     * @post Every pair within radius has been passed to the callback exactly once.
+     */
+    static size_t reportPairs(const PointSpan &points, double radius, const PairCallback &callback,
+                              size_t chunkSize = 4096, int threadCount = 0);
+};
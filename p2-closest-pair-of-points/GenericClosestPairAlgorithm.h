@@ -0,0 +1,474 @@
+/*
+ * @file GenericClosestPairAlgorithm.h
+ * @brief Declaration and implementation of the GenericClosestPairAlgorithm class template.
+ *
+ * This file contains the GenericClosestPairAlgorithm class template, a divide and conquer closest pair
+ * engine instantiated at compile time for a coordinate type and dimension. Points are split at the median
+ * of the first axis, and the slab of width 2 * delta around the dividing hyperplane is scanned in order of
+ * the second axis. The recursion merges each half back into second-axis order, so only the initial
+ * first-axis sort and a single scratch buffer are needed. The distance is set by a metric policy from
+ * DistanceMetric.h, Euclidean by default. All comparisons are done on the metric's monotone key (squared
+ * distance for Euclidean), which stays exact for integer coordinates. Since the key term of a single axis
+ * never exceeds the key of the pair, the slab width and the scan cut-off along the second axis follow from
+ * the metric: |dx| < delta for L1, L2 and L-infinity, and w_0 |dx|^p < delta^p for weighted Lp. In three or
+ * more dimensions, a slab can hold many points that are close along the second axis but far apart along the
+ * others. Once the scan of such a slab runs over a budget of comparisons per point, the slab is bucketed into
+ * a grid over every axis after the first, with cells as wide as delta allows along each axis, and each point
+ * is compared only with the points of its own and adjacent cells. Being a template, the class is implemented
+ * in this header.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "DistanceMetric.h"
+#include "GenericPoint.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+/*
+ * @brief Class template representing the closest pair algorithm over generic points.
+ */
+template <typename Coordinate, int Dimension, typename Metric = EuclideanMetric>
+class GenericClosestPairAlgorithm
+{
+public:
+    typedef GenericPoint<Coordinate, Dimension> PointType;
+    typedef typename Metric::template KeyTraits<Coordinate>::Type Key;
+    typedef Key SquaredDistance; // The key is the squared distance under the default Euclidean metric.
+    typedef GenericPointPair<Key, Metric> PairType;
+
+    /*
+     * @brief Find the closest pair of points using the divide and conquer algorithm.
+     * @param points The points to search for the closest pair.
+     * @param metric The metric to measure distances with, optional with a default-constructed one by default.
+     * @return The closest pair, identified by the positions of its points in the input vector.
+     * @pre The vector must contain at least two points.
+     * @post The closest pair and its key under the metric are returned.
+     */
+    static PairType findClosestPair(const std::vector<PointType> &points, const Metric &metric = Metric());
+
+private:
+    // Axis along which the slab around the dividing hyperplane is scanned, or sorted before the grid search.
+    static const int SCAN_AXIS = (Dimension > 1) ? 1 : 0;
+
+    // Comparisons per slab point after which a slab scan in three or more dimensions switches to a grid.
+    static const int SCAN_BUDGET = 16;
+
+    /*
+     * @brief Recursive function to find the closest pair in a range sorted by the first axis.
+     * @param points The points, sorted by the first axis on entry to the range.
+     * @param scratch Scratch buffer of the same size as points.
+     * @param leftIndex Index of the first point of the range.
+     * @param rightIndex Index one past the last point of the range.
+     * @param metric The metric to measure distances with.
+     * @return The closest pair of points in the specified range.
+     * @pre The range holds at least two points.
+     * @post The range is re-sorted by the scan axis and its closest pair is returned.
+     */
+    static PairType findClosestPairRecursive(std::vector<PointType> &points, std::vector<PointType> &scratch, int leftIndex, int rightIndex,
+                                             const Metric &metric);
+
+    /*
+     * @brief Find closer pairs in a slab by bucketing it into a grid over every axis after the first.
+     * @param slab The points, holding the slab from slabBegin to slabEnd.
+     * @param slabBegin Index of the first point of the slab.
+     * @param slabEnd Index one past the last point of the slab.
+     * @param metric The metric to measure distances with.
+     * @param closestPair The closest pair so far, replaced by any closer pair of the slab.
+     * @param minDistance The key of closestPair, updated along with it.
+     * @return False if the grid would be too fine to index, in which case nothing is searched.
+     * @pre minDistance is positive.
+     * @post Every pair of the slab closer than minDistance has been compared.
+     */
+    static bool searchSlabGrid(const std::vector<PointType> &slab, int slabBegin, int slabEnd, const Metric &metric, PairType &closestPair,
+                               Key &minDistance);
+
+    /*
+     * @brief Calculate the closest pair of a small range using a brute-force method.
+     * @param points The points.
+     * @param leftIndex Index of the first point of the range.
+     * @param rightIndex Index one past the last point of the range.
+     * @param metric The metric to measure distances with.
+     * @return The closest pair of points in the specified range.
+     * @pre The range holds at least two points.
+     * @post The range is re-sorted by the scan axis and its closest pair is returned.
+     */
+    static PairType bruteForceClosestPair(std::vector<PointType> &points, int leftIndex, int rightIndex, const Metric &metric);
+
+    /*
+     * @brief Calculate the key term of two points along one axis.
+     * @param a The first point.
+     * @param b The second point.
+     * @param axis The axis to compare along.
+     * @param metric The metric to measure distances with.
+     * @return The key term, which is at most the key of the two points.
+     * @pre axis is a valid axis.
+     * @post None.
+     */
+    static Key calculateAxisKey(const PointType &a, const PointType &b, int axis, const Metric &metric);
+
+    /*
+     * @brief Calculate the key of two points.
+     * @param a The first point.
+     * @param b The second point.
+     * @param metric The metric to measure distances with.
+     * @return The key, which is monotone in the distance under the metric.
+     * @pre None.
+     * @post None.
+     */
+    static Key calculateKey(const PointType &a, const PointType &b, const Metric &metric);
+
+    /*
+     * @brief Compare two points by the first axis, breaking ties by the remaining axes and then index.
+     * @param a The first point.
+     * @param b The second point.
+     * @return True if a comes before b.
+     * @pre None.
+     * @post No side effects on the input points.
+     */
+    static bool compareFirstAxis(const PointType &a, const PointType &b);
+
+    /*
+     * @brief Compare two points by the scan axis.
+     * @param a The first point.
+     * @param b The second point.
+     * @return True if a comes before b along the scan axis.
+     * @pre None.
+     * @post No side effects on the input points.
+     */
+    static bool compareScanAxis(const PointType &a, const PointType &b);
+};
+
+/*
+ * @brief Find the closest pair of points using the divide and conquer algorithm.
+ * @param points The points to search for the closest pair.
+ * @param metric The metric to measure distances with, optional with a default-constructed one by default.
+ * @return The closest pair, identified by the positions of its points in the input vector.
+ * @pre The vector must contain at least two points.
+ * @post The closest pair and its key under the metric are returned.
+ */
+template <typename Coordinate, int Dimension, typename Metric>
+typename GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::PairType
+GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::findClosestPair(const std::vector<PointType> &points, const Metric &metric)
+{
+    // Check if there are enough points to find a pair
+    int size = static_cast<int>(points.size());
+    if (size < 2)
+    {
+        std::cerr << "Error: The closest pair algorithm requires at least two points for accurate computation." << std::endl;
+        return PairType();
+    }
+
+    // Tag each point with its input position and sort by the first axis
+    std::vector<PointType> sortedPoints(points);
+    for (int i = 0; i < size; i++)
+    {
+        sortedPoints[i].setIndex(i);
+    }
+    std::sort(sortedPoints.begin(), sortedPoints.end(), compareFirstAxis);
+
+    // Call the recursive function with the entire range of points
+    std::vector<PointType> scratch(sortedPoints.size());
+    return findClosestPairRecursive(sortedPoints, scratch, 0, size, metric);
+}
+
+/*
+ * @brief Recursive function to find the closest pair in a range sorted by the first axis.
+ * @param points The points, sorted by the first axis on entry to the range.
+ * @param scratch Scratch buffer of the same size as points.
+ * @param leftIndex Index of the first point of the range.
+ * @param rightIndex Index one past the last point of the range.
+ * @param metric The metric to measure distances with.
+ * @return The closest pair of points in the specified range.
+ * @pre The range holds at least two points.
+ * @post The range is re-sorted by the scan axis and its closest pair is returned.
+ */
+template <typename Coordinate, int Dimension, typename Metric>
+typename GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::PairType
+GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::findClosestPairRecursive(std::vector<PointType> &points, std::vector<PointType> &scratch, int leftIndex, int rightIndex,
+                                                                                     const Metric &metric)
+{
+    // Base case: Use brute force for subarrays with three or fewer points
+    if (rightIndex - leftIndex <= 3)
+    {
+        return bruteForceClosestPair(points, leftIndex, rightIndex, metric);
+    }
+
+    // Split the subarray into two halves, remembering the dividing point before the halves are re-sorted
+    int mid = (leftIndex + rightIndex) / 2;
+    PointType midPoint = points[mid];
+
+    // Recursively find the closest pair in the two halves
+    PairType leftPair = findClosestPairRecursive(points, scratch, leftIndex, mid, metric);
+    PairType rightPair = findClosestPairRecursive(points, scratch, mid, rightIndex, metric);
+    PairType closestPair = (rightPair.getKey() < leftPair.getKey()) ? rightPair : leftPair;
+    Key minDistance = closestPair.getKey();
+
+    // Merge the two halves back into scan-axis order
+    std::merge(points.begin() + leftIndex, points.begin() + mid, points.begin() + mid, points.begin() + rightIndex,
+               scratch.begin() + leftIndex, compareScanAxis);
+    std::copy(scratch.begin() + leftIndex, scratch.begin() + rightIndex, points.begin() + leftIndex);
+
+    // Collect the slab of points whose first-axis term alone is below minDistance
+    int slabSize = 0;
+    for (int i = leftIndex; i < rightIndex; i++)
+    {
+        if (calculateAxisKey(points[i], midPoint, 0, metric) < minDistance)
+        {
+            scratch[leftIndex + slabSize] = points[i];
+            slabSize++;
+        }
+    }
+
+    // Check for closer pairs in the slab, scanning forward along the scan axis. Beyond two dimensions the scan
+    // can compare most pairs of the slab, so once it runs over its budget the slab is searched with a grid.
+    long long budget = (Dimension > 2) ? SCAN_BUDGET * static_cast<long long>(slabSize) : -1;
+    for (int i = leftIndex; i < leftIndex + slabSize; i++)
+    {
+        for (int j = i + 1; j < leftIndex + slabSize && calculateAxisKey(scratch[j], scratch[i], SCAN_AXIS, metric) < minDistance; j++)
+        {
+            if (--budget == 0 && searchSlabGrid(scratch, leftIndex, leftIndex + slabSize, metric, closestPair, minDistance))
+            {
+                return closestPair;
+            }
+            Key distance = calculateKey(scratch[i], scratch[j], metric);
+            if (distance < minDistance)
+            {
+                closestPair = PairType(scratch[i].getIndex(), scratch[j].getIndex(), distance);
+                minDistance = distance;
+            }
+        }
+    }
+
+    return closestPair;
+}
+
+/*
+ * @brief Find closer pairs in a slab by bucketing it into a grid over every axis after the first.
+ * @param slab The points, holding the slab from slabBegin to slabEnd.
+ * @param slabBegin Index of the first point of the slab.
+ * @param slabEnd Index one past the last point of the slab.
+ * @param metric The metric to measure distances with.
+ * @param closestPair The closest pair so far, replaced by any closer pair of the slab.
+ * @param minDistance The key of closestPair, updated along with it.
+ * @return False if the grid would be too fine to index, in which case nothing is searched.
+ * @pre minDistance is positive.
+ * @post Every pair of the slab closer than minDistance has been compared.
+ */
+template <typename Coordinate, int Dimension, typename Metric>
+bool GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::searchSlabGrid(const std::vector<PointType> &slab, int slabBegin, int slabEnd,
+                                                                                const Metric &metric, PairType &closestPair, Key &minDistance)
+{
+    // Cells are widened against rounding, and limited in number so that cell coordinates stay exact
+    const double CELL_SLACK = 1e-3;
+    const double MAX_CELLS = 4294967296.0;
+
+    // A pair closer than minDistance differs by less than distance / unit along an axis whose unit step has key unit
+    double distance = metric.toDistance(minDistance);
+    std::array<double, Dimension> sides, minimums;
+    for (int axis = 1; axis < Dimension; axis++)
+    {
+        double unit = metric.toDistance(metric.calculateAxisKey(static_cast<Key>(1), axis));
+        sides[axis] = distance / unit * (1.0 + CELL_SLACK);
+        double minimum = static_cast<double>(slab[slabBegin].getCoordinate(axis)), maximum = minimum;
+        for (int i = slabBegin; i < slabEnd; i++)
+        {
+            minimum = std::min(minimum, static_cast<double>(slab[i].getCoordinate(axis)));
+            maximum = std::max(maximum, static_cast<double>(slab[i].getCoordinate(axis)));
+        }
+        if (!(sides[axis] > 0.0) || !((maximum - minimum) / sides[axis] < MAX_CELLS))
+        {
+            return false;
+        }
+        minimums[axis] = minimum;
+    }
+
+    // Sort the slab by cell; the first axis is already bounded by the slab, so every cell spans it
+    typedef std::array<long long, Dimension> Cell;
+    std::vector<std::pair<Cell, int>> cells(slabEnd - slabBegin);
+    for (int i = slabBegin; i < slabEnd; i++)
+    {
+        Cell cell;
+        cell[0] = 0;
+        for (int axis = 1; axis < Dimension; axis++)
+        {
+            double offset = static_cast<double>(slab[i].getCoordinate(axis)) - minimums[axis];
+            cell[axis] = static_cast<long long>(std::floor(offset / sides[axis]));
+        }
+        cells[i - slabBegin] = std::make_pair(cell, i);
+    }
+    std::sort(cells.begin(), cells.end());
+
+    // Compare each point with the later points of its own cell, and with every adjacent cell whose first
+    // differing axis is ahead, so that each pair of adjacent cells is visited from one side only
+    int neighborCount = 1;
+    for (int axis = 1; axis < Dimension; axis++)
+    {
+        neighborCount *= 3;
+    }
+    for (size_t k = 0; k < cells.size(); k++)
+    {
+        const PointType &point = slab[cells[k].second];
+        for (size_t other = k + 1; other < cells.size() && cells[other].first == cells[k].first; other++)
+        {
+            Key key = calculateKey(point, slab[cells[other].second], metric);
+            if (key < minDistance)
+            {
+                closestPair = PairType(point.getIndex(), slab[cells[other].second].getIndex(), key);
+                minDistance = key;
+            }
+        }
+        for (int neighbor = 0; neighbor < neighborCount; neighbor++)
+        {
+            // Decode the neighbor's offset of -1, 0 or 1 along every axis after the first
+            Cell cell = cells[k].first;
+            int code = neighbor, firstStep = 0;
+            for (int axis = 1; axis < Dimension; axis++)
+            {
+                int step = code % 3 - 1;
+                code /= 3;
+                cell[axis] += step;
+                firstStep = (firstStep == 0) ? step : firstStep;
+            }
+            if (firstStep <= 0)
+            {
+                continue;
+            }
+
+            auto other = std::lower_bound(cells.begin(), cells.end(), std::make_pair(cell, slabBegin));
+            for (; other != cells.end() && other->first == cell; ++other)
+            {
+                Key key = calculateKey(point, slab[other->second], metric);
+                if (key < minDistance)
+                {
+                    closestPair = PairType(point.getIndex(), slab[other->second].getIndex(), key);
+                    minDistance = key;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/*
+ * @brief Calculate the closest pair of a small range using a brute-force method.
+ * @param points The points.
+ * @param leftIndex Index of the first point of the range.
+ * @param rightIndex Index one past the last point of the range.
+ * @param metric The metric to measure distances with.
+ * @return The closest pair of points in the specified range.
+ * @pre The range holds at least two points.
+ * @post The range is re-sorted by the scan axis and its closest pair is returned.
+ */
+template <typename Coordinate, int Dimension, typename Metric>
+typename GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::PairType
+GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::bruteForceClosestPair(std::vector<PointType> &points, int leftIndex, int rightIndex, const Metric &metric)
+{
+    PairType closestPair;
+    for (int i = leftIndex; i < rightIndex; i++)
+    {
+        for (int j = i + 1; j < rightIndex; j++)
+        {
+            Key distance = calculateKey(points[i], points[j], metric);
+            if (distance < closestPair.getKey())
+            {
+                closestPair = PairType(points[i].getIndex(), points[j].getIndex(), distance);
+            }
+        }
+    }
+
+    // Leave the range in scan-axis order for the caller's merge
+    std::sort(points.begin() + leftIndex, points.begin() + rightIndex, compareScanAxis);
+    return closestPair;
+}
+
+/*
+ * @brief Calculate the key term of two points along one axis.
+ * @param a The first point.
+ * @param b The second point.
+ * @param axis The axis to compare along.
+ * @param metric The metric to measure distances with.
+ * @return The key term, which is at most the key of the two points.
+ * @pre axis is a valid axis.
+ * @post None.
+ */
+template <typename Coordinate, int Dimension, typename Metric>
+typename GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::Key
+GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::calculateAxisKey(const PointType &a, const PointType &b, int axis, const Metric &metric)
+{
+    // Widen before subtracting so integer differences cannot overflow the coordinate type
+    Key difference = static_cast<Key>(a.getCoordinate(axis)) - static_cast<Key>(b.getCoordinate(axis));
+    return metric.calculateAxisKey(difference, axis);
+}
+
+/*
+ * @brief Calculate the key of two points.
+ * @param a The first point.
+ * @param b The second point.
+ * @param metric The metric to measure distances with.
+ * @return The key, which is monotone in the distance under the metric.
+ * @pre None.
+ * @post None.
+ */
+template <typename Coordinate, int Dimension, typename Metric>
+typename GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::Key
+GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::calculateKey(const PointType &a, const PointType &b, const Metric &metric)
+{
+    // The axis count is a compile-time constant, so this loop unrolls into straight-line, branch-free code
+    Key key = calculateAxisKey(a, b, 0, metric);
+    for (int axis = 1; axis < Dimension; axis++)
+    {
+        key = metric.combineKeys(key, calculateAxisKey(a, b, axis, metric));
+    }
+    return key;
+}
+
+/*
+ * @brief Compare two points by the first axis, breaking ties by the remaining axes and then index.
+ * @param a The first point.
+ * @param b The second point.
+ * @return True if a comes before b.
+ * @pre None.
+ * @post No side effects on the input points.
+ */
+template <typename Coordinate, int Dimension, typename Metric>
+bool GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::compareFirstAxis(const PointType &a, const PointType &b)
+{
+    for (int axis = 0; axis < Dimension; axis++)
+    {
+        if (a.getCoordinate(axis) != b.getCoordinate(axis))
+        {
+            return a.getCoordinate(axis) < b.getCoordinate(axis);
+        }
+    }
+    return a.getIndex() < b.getIndex();
+}
+
+/*
+ * @brief Compare two points by the scan axis.
+ * @param a The first point.
+ * @param b The second point.
+ * @return True if a comes before b along the scan axis.
+ * @pre None.
+ * @post No side effects on the input points.
+ */
+template <typename Coordinate, int Dimension, typename Metric>
+bool GenericClosestPairAlgorithm<Coordinate, Dimension, Metric>::compareScanAxis(const PointType &a, const PointType &b)
+{
+    return a.getCoordinate(SCAN_AXIS) < b.getCoordinate(SCAN_AXIS);
+}
+
+// Common instantiations: half-memory sensor data, exact grid coordinates, and 3D points.
+typedef GenericClosestPairAlgorithm<float, 2> FloatClosestPairAlgorithm;
+typedef GenericClosestPairAlgorithm<std::int64_t, 2> IntegerClosestPairAlgorithm;
+typedef GenericClosestPairAlgorithm<double, 3> ClosestPairAlgorithm3D;
+
+// Grid-based planning, such as warehouse robots moving along aisles, and king-move distances.
+typedef GenericClosestPairAlgorithm<double, 2, ManhattanMetric> ManhattanClosestPairAlgorithm;
+typedef GenericClosestPairAlgorithm<double, 2, ChebyshevMetric> ChebyshevClosestPairAlgorithm;
@@ -0,0 +1,331 @@
+/*
+ * @file GenericPoint.h
+ * @brief Declaration and implementation of the GenericPoint and GenericPointPair class templates.
+ *
+ * This file defines the GenericPoint class template, representing a point whose coordinate type and
+ * dimension are chosen at compile time, and the GenericPointPair class template, which identifies two
+ * such points by their original input indices together with their distance key under a metric from
+ * DistanceMetric.h (the squared distance by default). Squared distances of integer coordinates are
+ * computed exactly in 64-bit integers; floating-point coordinates keep their own precision. Being
+ * templates, both classes are implemented in this header.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "DistanceMetric.h"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/*
+ * @brief Class template representing a point in a space of the given dimension.
+ */
+template <typename Coordinate, int Dimension>
+class GenericPoint
+{
+    static_assert(Dimension >= 1, "GenericPoint requires at least one dimension.");
+
+public:
+    typedef Coordinate CoordinateType;
+    typedef typename SquaredDistanceTraits<Coordinate>::Type SquaredDistance;
+    static const int DIMENSION = Dimension;
+
+    /*
+     * @brief Default constructor for GenericPoint class.
+     * @pre None.
+     * @post A GenericPoint object is created at the origin with index -1.
+     */
+    GenericPoint();
+
+    /*
+     * @brief Constructor for GenericPoint class.
+     * @param coordinates The coordinates of the point.
+     * @param index The index of the point, optional with a default of -1.
+     * @pre None.
+     * @post A GenericPoint object is created with the specified coordinates and index.
+     */
+    explicit GenericPoint(const std::array<Coordinate, Dimension> &coordinates, int index = -1);
+
+    /*
+     * @brief Get one coordinate of the point.
+     * @param axis The axis of the coordinate, from 0 to Dimension - 1.
+     * @return The coordinate along the given axis.
+     * @pre axis is a valid axis.
+     * @post The coordinate is returned.
+     */
+    Coordinate getCoordinate(int axis) const;
+
+    /*
+     * @brief Get the index of the point.
+     * @return The index of the point.
+     * @pre The GenericPoint object must exist.
+     * @post The index of the point is returned.
+     */
+    int getIndex() const;
+
+    /*
+     * @brief Set the index of the point.
+     * @param newIndex The new index to set.
+     * @pre The GenericPoint object must exist.
+     * @post The index of the point is updated to the new index.
+     */
+    void setIndex(int newIndex);
+
+    /*
+     * @brief Calculate the squared difference of two points along one axis.
+     * @param a The first point.
+     * @param b The second point.
+     * @param axis The axis to compare along.
+     * @return The squared coordinate difference, in the squared distance type.
+     * @pre axis is a valid axis.
+     * @post None.
+     */
+    static SquaredDistance calculateSquaredDifference(const GenericPoint &a, const GenericPoint &b, int axis);
+
+    /*
+     * @brief Calculate the squared Euclidean distance between two points.
+     * @param a The first point.
+     * @param b The second point.
+     * @return The squared Euclidean distance, exact for integer coordinates.
+     * @pre The points a and b must be valid GenericPoint objects.
+     * @post None.
+     */
+    static SquaredDistance calculateSquaredDistance(const GenericPoint &a, const GenericPoint &b);
+
+private:
+    std::array<Coordinate, Dimension> coordinates; // Coordinates of the point, one per axis.
+    int index;                                     // Index of the point.
+};
+
+/*
+ * @brief Class template representing a pair of generic points identified by their original input indices.
+ */
+template <typename Key, typename Metric = EuclideanMetric>
+class GenericPointPair
+{
+public:
+    /*
+     * @brief Default constructor for GenericPointPair class.
+     * @pre None.
+     * @post An empty pair is created with indices -1 and the maximum possible key.
+     */
+    GenericPointPair();
+
+    /*
+     * @brief Constructor for GenericPointPair class.
+     * @param firstIndex The original input index of the first point.
+     * @param secondIndex The original input index of the second point.
+     * @param key The key of the two points under Metric, which is their squared distance by default.
+     * @pre None.
+     * @post A pair is created with the smaller index stored first.
+     */
+    GenericPointPair(int firstIndex, int secondIndex, Key key);
+
+    /*
+     * @brief Get the original input index of the first point.
+     * @return The index of the first point.
+     * @pre The GenericPointPair object must exist.
+     * @post The index of the first point is returned.
+     */
+    int getFirstIndex() const;
+
+    /*
+     * @brief Get the original input index of the second point.
+     * @return The index of the second point.
+     * @pre The GenericPointPair object must exist.
+     * @post The index of the second point is returned.
+     */
+    int getSecondIndex() const;
+
+    /*
+     * @brief Get the key of the two points under Metric.
+     * @return The key: the squared distance for the default Euclidean metric, exact for integer coordinates.
+     * @pre The GenericPointPair object must exist.
+     * @post The key is returned.
+     */
+    Key getKey() const;
+
+    /*
+     * @brief Get the distance between the two points.
+     * @return The distance under Metric, converted from the key.
+     * @pre The GenericPointPair object must exist.
+     * @post The distance is returned.
+     */
+    double getDistance() const;
+
+private:
+    int firstIndex;  // Original input index of the first point in the pair.
+    int secondIndex; // Original input index of the second point in the pair.
+    Key key;         // Key of the two points under Metric.
+};
+
+/*
+ * @brief Default constructor for GenericPoint class.
+ * @pre None.
+ * @post A GenericPoint object is created at the origin with index -1.
+ */
+template <typename Coordinate, int Dimension>
+GenericPoint<Coordinate, Dimension>::GenericPoint() : index(-1)
+{
+    this->coordinates.fill(Coordinate());
+}
+
+/*
+ * @brief Constructor for GenericPoint class.
+ * @param coordinates The coordinates of the point.
+ * @param index The index of the point, optional with a default of -1.
+ * @pre None.
+ * @post A GenericPoint object is created with the specified coordinates and index.
+ */
+template <typename Coordinate, int Dimension>
+GenericPoint<Coordinate, Dimension>::GenericPoint(const std::array<Coordinate, Dimension> &coordinates, int index)
+    : coordinates(coordinates), index(index) {}
+
+/*
+ * @brief Get one coordinate of the point.
+ * @param axis The axis of the coordinate, from 0 to Dimension - 1.
+ * @return The coordinate along the given axis.
+ * @pre axis is a valid axis.
+ * @post The coordinate is returned.
+ */
+template <typename Coordinate, int Dimension>
+Coordinate GenericPoint<Coordinate, Dimension>::getCoordinate(int axis) const
+{
+    return this->coordinates[axis];
+}
+
+/*
+ * @brief Get the index of the point.
+ * @return The index of the point.
+ * @pre The GenericPoint object must exist.
+ * @post The index of the point is returned.
+ */
+template <typename Coordinate, int Dimension>
+int GenericPoint<Coordinate, Dimension>::getIndex() const
+{
+    return this->index;
+}
+
+/*
+ * @brief Set the index of the point.
+ * @param newIndex The new index to set.
+ * @pre The GenericPoint object must exist.
+ * @post The index of the point is updated to the new index.
+ */
+template <typename Coordinate, int Dimension>
+void GenericPoint<Coordinate, Dimension>::setIndex(int newIndex)
+{
+    this->index = newIndex;
+}
+
+/*
+ * @brief Calculate the squared difference of two points along one axis.
+ * @param a The first point.
+ * @param b The second point.
+ * @param axis The axis to compare along.
+ * @return The squared coordinate difference, in the squared distance type.
+ * @pre axis is a valid axis.
+ * @post None.
+ */
+template <typename Coordinate, int Dimension>
+typename GenericPoint<Coordinate, Dimension>::SquaredDistance
+GenericPoint<Coordinate, Dimension>::calculateSquaredDifference(const GenericPoint &a, const GenericPoint &b, int axis)
+{
+    // Widen before subtracting so integer differences cannot overflow the coordinate type
+    SquaredDistance difference = static_cast<SquaredDistance>(a.coordinates[axis]) - static_cast<SquaredDistance>(b.coordinates[axis]);
+    return difference * difference;
+}
+
+/*
+ * @brief Calculate the squared Euclidean distance between two points.
+ * @param a The first point.
+ * @param b The second point.
+ * @return The squared Euclidean distance, exact for integer coordinates.
+ * @pre The points a and b must be valid GenericPoint objects.
+ * @post None.
+ */
+template <typename Coordinate, int Dimension>
+typename GenericPoint<Coordinate, Dimension>::SquaredDistance
+GenericPoint<Coordinate, Dimension>::calculateSquaredDistance(const GenericPoint &a, const GenericPoint &b)
+{
+    SquaredDistance sum = SquaredDistance();
+    for (int axis = 0; axis < Dimension; axis++)
+    {
+        sum += calculateSquaredDifference(a, b, axis);
+    }
+    return sum;
+}
+
+/*
+ * @brief Default constructor for GenericPointPair class.
+ * @pre None.
+ * @post An empty pair is created with indices -1 and the maximum possible key.
+ */
+template <typename Key, typename Metric>
+GenericPointPair<Key, Metric>::GenericPointPair()
+    : firstIndex(-1), secondIndex(-1), key(std::numeric_limits<Key>::max()) {}
+
+/*
+ * @brief Constructor for GenericPointPair class.
+ * @param firstIndex The original input index of the first point.
+ * @param secondIndex The original input index of the second point.
+ * @param key The key of the two points under Metric, which is their squared distance by default.
+ * @pre None.
+ * @post A pair is created with the smaller index stored first.
+ */
+template <typename Key, typename Metric>
+GenericPointPair<Key, Metric>::GenericPointPair(int firstIndex, int secondIndex, Key key)
+    : firstIndex(firstIndex < secondIndex ? firstIndex : secondIndex),
+      secondIndex(firstIndex < secondIndex ? secondIndex : firstIndex),
+      key(key) {}
+
+/*
+ * @brief Get the original input index of the first point.
+ * @return The index of the first point.
+ * @pre The GenericPointPair object must exist.
+ * @post The index of the first point is returned.
+ */
+template <typename Key, typename Metric>
+int GenericPointPair<Key, Metric>::getFirstIndex() const
+{
+    return this->firstIndex;
+}
+
+/*
+ * @brief Get the original input index of the second point.
+ * @return The index of the second point.
+ * @pre The GenericPointPair object must exist.
+ * @post The index of the second point is returned.
+ */
+template <typename Key, typename Metric>
+int GenericPointPair<Key, Metric>::getSecondIndex() const
+{
+    return this->secondIndex;
+}
+
+/*
+ * @brief Get the key of the two points under Metric.
+ * @return The key: the squared distance for the default Euclidean metric, exact for integer coordinates.
+ * @pre The GenericPointPair object must exist.
+ * @post The key is returned.
+ */
+template <typename Key, typename Metric>
+Key GenericPointPair<Key, Metric>::getKey() const
+{
+    return this->key;
+}
+
+/*
+ * @brief Get the distance between the two points.
+ * @return The distance under Metric, converted from the key.
+ * @pre The GenericPointPair object must exist.
+ * @post The distance is returned.
+ */
+template <typename Key, typename Metric>
+double GenericPointPair<Key, Metric>::getDistance() const
+{
+    return Metric::toDistance(this->key);
+}
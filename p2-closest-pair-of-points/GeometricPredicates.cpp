@@ -0,0 +1,731 @@
+/*
+ * @file GeometricPredicates.cpp
+ * @brief Implementation of the GeometricPredicates class, robust orientation and in-circle tests.
+ *
+ * This file contains the implementation of the GeometricPredicates class, following Shewchuk's "Adaptive
+ * Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates". Exact values are represented as
+ * expansions: sums of doubles that do not overlap and are stored in increasing order of magnitude, so the sign
+ * of an expansion is the sign of its last component. Each test runs in stages of increasing precision and stops
+ * at the first stage whose error bound settles the sign. Every expansion has a bounded length, so the stages work
+ * on fixed-size arrays on the stack and never allocate.
+ *
+ * @author Phat Tran
+ */
+
+#include "GeometricPredicates.h"
+#include <cmath>
+
+using namespace std;
+
+// Half of the unit roundoff of a double (2^-53)
+const double EPSILON = ldexp(1.0, -53);
+
+// Splits a double into two halves of 26 bits each, so their products are exact
+const double SPLITTER = ldexp(1.0, 27) + 1.0;
+
+// Relative error bounds of the stages of the orientation and in-circle tests
+const double RESULT_ERROR_BOUND = (3.0 + 8.0 * EPSILON) * EPSILON;
+const double ORIENT_ERROR_BOUND_A = (3.0 + 16.0 * EPSILON) * EPSILON;
+const double ORIENT_ERROR_BOUND_B = (2.0 + 12.0 * EPSILON) * EPSILON;
+const double ORIENT_ERROR_BOUND_C = (9.0 + 64.0 * EPSILON) * EPSILON * EPSILON;
+const double INCIRCLE_ERROR_BOUND_A = (10.0 + 96.0 * EPSILON) * EPSILON;
+const double INCIRCLE_ERROR_BOUND_B = (4.0 + 48.0 * EPSILON) * EPSILON;
+const double INCIRCLE_ERROR_BOUND_C = (44.0 + 576.0 * EPSILON) * EPSILON * EPSILON;
+
+/*
+ * @brief Exact sum of two doubles, the first of which is at least as large in magnitude.
+ * @param a The larger value.
+ * @param b The smaller value.
+ * @param sum Receives the rounded sum.
+ * @param error Receives the rounding error, so that sum + error == a + b exactly.
+ */
+static void fastTwoSum(double a, double b, double &sum, double &error)
+{
+    sum = a + b;
+    double bVirtual = sum - a;
+    error = b - bVirtual;
+}
+
+/*
+ * @brief Exact sum of two doubles.
+ * @param a The first value.
+ * @param b The second value.
+ * @param sum Receives the rounded sum.
+ * @param error Receives the rounding error, so that sum + error == a + b exactly.
+ */
+static void twoSum(double a, double b, double &sum, double &error)
+{
+    sum = a + b;
+    double bVirtual = sum - a;
+    double aVirtual = sum - bVirtual;
+    error = (a - aVirtual) + (b - bVirtual);
+}
+
+/*
+ * @brief Rounding error of a difference of two doubles.
+ * @param a The minuend.
+ * @param b The subtrahend.
+ * @param difference The rounded difference a - b.
+ * @return The error, so that difference + error == a - b exactly.
+ */
+static double twoDiffTail(double a, double b, double difference)
+{
+    double bVirtual = a - difference;
+    double aVirtual = difference + bVirtual;
+    return (a - aVirtual) + (bVirtual - b);
+}
+
+/*
+ * @brief Exact difference of two doubles.
+ * @param a The minuend.
+ * @param b The subtrahend.
+ * @param difference Receives the rounded difference.
+ * @param error Receives the rounding error, so that difference + error == a - b exactly.
+ */
+static void twoDiff(double a, double b, double &difference, double &error)
+{
+    difference = a - b;
+    error = twoDiffTail(a, b, difference);
+}
+
+/*
+ * @brief Split a double into a high and a low half that sum to it exactly.
+ * @param a The value.
+ * @param high Receives the high 26 bits.
+ * @param low Receives the rest.
+ */
+static void split(double a, double &high, double &low)
+{
+    double c = SPLITTER * a;
+    double aBig = c - a;
+    high = c - aBig;
+    low = a - high;
+}
+
+/*
+ * @brief Exact product of two doubles.
+ * @param a The first value.
+ * @param b The second value.
+ * @param product Receives the rounded product.
+ * @param error Receives the rounding error, so that product + error == a * b exactly.
+ */
+static void twoProduct(double a, double b, double &product, double &error)
+{
+    product = a * b;
+    double aHigh, aLow, bHigh, bLow;
+    split(a, aHigh, aLow);
+    split(b, bHigh, bLow);
+    double error1 = product - aHigh * bHigh;
+    double error2 = error1 - aLow * bHigh;
+    double error3 = error2 - aHigh * bLow;
+    error = aLow * bLow - error3;
+}
+
+/*
+ * @brief Exact square of a double.
+ * @param a The value.
+ * @param square Receives the rounded square.
+ * @param error Receives the rounding error, so that square + error == a * a exactly.
+ */
+static void twoSquare(double a, double &square, double &error)
+{
+    square = a * a;
+    double aHigh, aLow;
+    split(a, aHigh, aLow);
+    double error1 = square - aHigh * aHigh;
+    double error3 = error1 - (aHigh + aHigh) * aLow;
+    error = aLow * aLow - error3;
+}
+
+/*
+ * @brief Exact sum of two two-component expansions.
+ * @param a1 The larger component of the first expansion.
+ * @param a0 The smaller component of the first expansion.
+ * @param b1 The larger component of the second expansion.
+ * @param b0 The smaller component of the second expansion.
+ * @param x Receives the four-component expansion equal to (a1 + a0) + (b1 + b0).
+ */
+static void twoTwoSum(double a1, double a0, double b1, double b0, double x[4])
+{
+    double i, j, k;
+    twoSum(a0, b0, i, x[0]);
+    twoSum(a1, i, j, k);
+    twoSum(k, b1, i, x[1]);
+    twoSum(j, i, x[3], x[2]);
+}
+
+/*
+ * @brief Exact difference of two two-component expansions.
+ * @param a1 The larger component of the minuend.
+ * @param a0 The smaller component of the minuend.
+ * @param b1 The larger component of the subtrahend.
+ * @param b0 The smaller component of the subtrahend.
+ * @param x Receives the four-component expansion equal to (a1 + a0) - (b1 + b0).
+ */
+static void twoTwoDiff(double a1, double a0, double b1, double b0, double x[4])
+{
+    double i, j, k;
+    twoDiff(a0, b0, i, x[0]);
+    twoSum(a1, i, j, k);
+    twoDiff(k, b1, i, x[1]);
+    twoSum(j, i, x[3], x[2]);
+}
+
+/*
+ * @brief Exact sum of two expansions.
+ * @param eLength The number of components of e.
+ * @param e The first expansion.
+ * @param fLength The number of components of f.
+ * @param f The second expansion.
+ * @param h Receives the expansion equal to e + f, with zero components removed; it has room for eLength + fLength components.
+ * @return The number of components of h, at least 1.
+ */
+static int sumExpansions(int eLength, const double *e, int fLength, const double *f, double *h)
+{
+    // Merge the components by magnitude and carry the running sum through them (Shewchuk's FAST-EXPANSION-SUM)
+    int eIndex = 0, fIndex = 0, hIndex = 0;
+    double eNow = e[0], fNow = f[0];
+    double q, qNew, error;
+    if ((fNow > eNow) == (fNow > -eNow))
+    {
+        q = eNow;
+        eNow = (++eIndex < eLength) ? e[eIndex] : 0.0;
+    }
+    else
+    {
+        q = fNow;
+        fNow = (++fIndex < fLength) ? f[fIndex] : 0.0;
+    }
+    if (eIndex < eLength && fIndex < fLength)
+    {
+        if ((fNow > eNow) == (fNow > -eNow))
+        {
+            fastTwoSum(eNow, q, qNew, error);
+            eNow = (++eIndex < eLength) ? e[eIndex] : 0.0;
+        }
+        else
+        {
+            fastTwoSum(fNow, q, qNew, error);
+            fNow = (++fIndex < fLength) ? f[fIndex] : 0.0;
+        }
+        q = qNew;
+        if (error != 0.0)
+        {
+            h[hIndex++] = error;
+        }
+        while (eIndex < eLength && fIndex < fLength)
+        {
+            if ((fNow > eNow) == (fNow > -eNow))
+            {
+                twoSum(q, eNow, qNew, error);
+                eNow = (++eIndex < eLength) ? e[eIndex] : 0.0;
+            }
+            else
+            {
+                twoSum(q, fNow, qNew, error);
+                fNow = (++fIndex < fLength) ? f[fIndex] : 0.0;
+            }
+            q = qNew;
+            if (error != 0.0)
+            {
+                h[hIndex++] = error;
+            }
+        }
+    }
+    while (eIndex < eLength)
+    {
+        twoSum(q, eNow, qNew, error);
+        eNow = (++eIndex < eLength) ? e[eIndex] : 0.0;
+        q = qNew;
+        if (error != 0.0)
+        {
+            h[hIndex++] = error;
+        }
+    }
+    while (fIndex < fLength)
+    {
+        twoSum(q, fNow, qNew, error);
+        fNow = (++fIndex < fLength) ? f[fIndex] : 0.0;
+        q = qNew;
+        if (error != 0.0)
+        {
+            h[hIndex++] = error;
+        }
+    }
+    if (q != 0.0 || hIndex == 0)
+    {
+        h[hIndex++] = q;
+    }
+    return hIndex;
+}
+
+/*
+ * @brief Exact product of an expansion and a double.
+ * @param eLength The number of components of e.
+ * @param e The expansion.
+ * @param b The factor.
+ * @param h Receives the expansion equal to e * b, with zero components removed; it has room for 2 * eLength components.
+ * @return The number of components of h, at least 1.
+ */
+static int scaleExpansion(int eLength, const double *e, double b, double *h)
+{
+    int hIndex = 0;
+    double q, error;
+    twoProduct(e[0], b, q, error);
+    if (error != 0.0)
+    {
+        h[hIndex++] = error;
+    }
+    for (int eIndex = 1; eIndex < eLength; eIndex++)
+    {
+        double product1, product0, sum;
+        twoProduct(e[eIndex], b, product1, product0);
+        twoSum(q, product0, sum, error);
+        if (error != 0.0)
+        {
+            h[hIndex++] = error;
+        }
+        fastTwoSum(product1, sum, q, error);
+        if (error != 0.0)
+        {
+            h[hIndex++] = error;
+        }
+    }
+    if (q != 0.0 || hIndex == 0)
+    {
+        h[hIndex++] = q;
+    }
+    return hIndex;
+}
+
+/*
+ * @brief Approximate the value of an expansion.
+ * @param eLength The number of components of e.
+ * @param e The expansion.
+ * @return The rounded sum of the components.
+ */
+static double estimate(int eLength, const double *e)
+{
+    double value = e[0];
+    for (int i = 1; i < eLength; i++)
+    {
+        value += e[i];
+    }
+    return value;
+}
+
+/*
+ * @brief Add an expansion to a running total held in one of two buffers.
+ * @param total The buffer holding the total; swapped with spare to point at the new total.
+ * @param spare The other buffer, which receives the new total.
+ * @param totalLength The number of components of the total; updated.
+ * @param length The number of components of the expansion.
+ * @param expansion The expansion to add.
+ */
+static void accumulate(double *&total, double *&spare, int &totalLength, int length, const double *expansion)
+{
+    totalLength = sumExpansions(totalLength, total, length, expansion, spare);
+    double *swap = total;
+    total = spare;
+    spare = swap;
+}
+
+/*
+ * @brief Orientation test for three points.
+ * @return A positive value if a, b, c are in counterclockwise order, negative if clockwise, zero if collinear.
+ * @pre The coordinates are finite.
+ * @post The sign of the returned value is exact.
+ */
+double GeometricPredicates::orient2d(double ax, double ay, double bx, double by, double cx, double cy)
+{
+    double detLeft = (ax - cx) * (by - cy);
+    double detRight = (ay - cy) * (bx - cx);
+    double det = detLeft - detRight;
+
+    // Trust the double result when it is farther from zero than its error bound
+    double detSum = fabs(detLeft) + fabs(detRight);
+    double errorBound = ORIENT_ERROR_BOUND_A * detSum;
+    if (det > errorBound || -det > errorBound)
+    {
+        return det;
+    }
+    return orient2dAdaptive(ax, ay, bx, by, cx, cy, detSum);
+}
+
+/*
+ * @brief In-circle test for four points.
+ * @return A positive value if d lies inside the circle through a, b, c (given in counterclockwise order),
+ *         negative if outside, zero if the four points are cocircular.
+ * @pre The coordinates are finite.
+ * @post The sign of the returned value is exact.
+ */
+double GeometricPredicates::incircle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy)
+{
+    double adx = ax - dx, ady = ay - dy;
+    double bdx = bx - dx, bdy = by - dy;
+    double cdx = cx - dx, cdy = cy - dy;
+
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady, adxcdy = adx * cdy;
+    double adxbdy = adx * bdy, bdxady = bdx * ady;
+    double alift = adx * adx + ady * ady;
+    double blift = bdx * bdx + bdy * bdy;
+    double clift = cdx * cdx + cdy * cdy;
+
+    double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+
+    // Trust the double result when it is farther from zero than its error bound
+    double permanent = (fabs(bdxcdy) + fabs(cdxbdy)) * alift + (fabs(cdxady) + fabs(adxcdy)) * blift +
+                       (fabs(adxbdy) + fabs(bdxady)) * clift;
+    double errorBound = INCIRCLE_ERROR_BOUND_A * permanent;
+    if (det > errorBound || -det > errorBound)
+    {
+        return det;
+    }
+    return incircleAdaptive(ax, ay, bx, by, cx, cy, dx, dy, permanent);
+}
+
+/*
+ * @brief Orientation determinant refined in stages until its sign is certain.
+ * @param detSum The sum of the magnitudes of the two products of the double-precision determinant.
+ * @return A value with the exact sign of the orientation determinant.
+ * @pre The coordinates are finite and the double-precision determinant was too close to zero to trust.
+ * @post None.
+ */
+double GeometricPredicates::orient2dAdaptive(double ax, double ay, double bx, double by, double cx, double cy, double detSum)
+{
+    // Stage B: the exact determinant of the rounded coordinate differences
+    double acx = ax - cx, bcx = bx - cx;
+    double acy = ay - cy, bcy = by - cy;
+    double detLeft, detLeftTail, detRight, detRightTail;
+    twoProduct(acx, bcy, detLeft, detLeftTail);
+    twoProduct(acy, bcx, detRight, detRightTail);
+    double b[4];
+    twoTwoDiff(detLeft, detLeftTail, detRight, detRightTail, b);
+
+    double det = estimate(4, b);
+    double errorBound = ORIENT_ERROR_BOUND_B * detSum;
+    if (det >= errorBound || -det >= errorBound)
+    {
+        return det;
+    }
+
+    // The differences were exact, so the determinant above is exact
+    double acxTail = twoDiffTail(ax, cx, acx), bcxTail = twoDiffTail(bx, cx, bcx);
+    double acyTail = twoDiffTail(ay, cy, acy), bcyTail = twoDiffTail(by, cy, bcy);
+    if (acxTail == 0.0 && acyTail == 0.0 && bcxTail == 0.0 && bcyTail == 0.0)
+    {
+        return det;
+    }
+
+    // Stage C: add the first-order terms of the differences' rounding errors in double precision
+    errorBound = ORIENT_ERROR_BOUND_C * detSum + RESULT_ERROR_BOUND * fabs(det);
+    det += (acx * bcyTail + bcy * acxTail) - (acy * bcxTail + bcx * acyTail);
+    if (det >= errorBound || -det >= errorBound)
+    {
+        return det;
+    }
+
+    // Stage D: add every remaining term exactly
+    double s1, s0, t1, t0, u[4];
+    double c1[8], c2[12], d[16];
+    twoProduct(acxTail, bcy, s1, s0);
+    twoProduct(acyTail, bcx, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    int c1Length = sumExpansions(4, b, 4, u, c1);
+
+    twoProduct(acx, bcyTail, s1, s0);
+    twoProduct(acy, bcxTail, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    int c2Length = sumExpansions(c1Length, c1, 4, u, c2);
+
+    twoProduct(acxTail, bcyTail, s1, s0);
+    twoProduct(acyTail, bcxTail, t1, t0);
+    twoTwoDiff(s1, s0, t1, t0, u);
+    int dLength = sumExpansions(c2Length, c2, 4, u, d);
+
+    return d[dLength - 1];
+}
+
+/*
+ * @brief In-circle determinant refined in stages until its sign is certain.
+ * @param permanent The permanent of the double-precision determinant, which bounds its rounding error.
+ * @return A value with the exact sign of the in-circle determinant.
+ * @pre The coordinates are finite and the double-precision determinant was too close to zero to trust.
+ * @post None.
+ */
+double GeometricPredicates::incircleAdaptive(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy,
+                                             double permanent)
+{
+    // Stage B: the exact determinant of the rounded coordinate differences
+    double adx = ax - dx, bdx = bx - dx, cdx = cx - dx;
+    double ady = ay - dy, bdy = by - dy, cdy = cy - dy;
+
+    double product1, product0, otherProduct1, otherProduct0;
+    double bc[4], ca[4], ab[4];
+    twoProduct(bdx, cdy, product1, product0);
+    twoProduct(cdx, bdy, otherProduct1, otherProduct0);
+    twoTwoDiff(product1, product0, otherProduct1, otherProduct0, bc);
+    twoProduct(cdx, ady, product1, product0);
+    twoProduct(adx, cdy, otherProduct1, otherProduct0);
+    twoTwoDiff(product1, product0, otherProduct1, otherProduct0, ca);
+    twoProduct(adx, bdy, product1, product0);
+    twoProduct(bdx, ady, otherProduct1, otherProduct0);
+    twoTwoDiff(product1, product0, otherProduct1, otherProduct0, ab);
+
+    // Each term is lift * minor = (dx^2 + dy^2) * minor, built from two scalings by each coordinate
+    double xMinor[8], xxMinor[16], yMinor[8], yyMinor[16];
+    double aDet[32], bDet[32], cDet[32], abDet[64];
+    int xLength, xxLength, yLength, yyLength;
+
+    xLength = scaleExpansion(4, bc, adx, xMinor);
+    xxLength = scaleExpansion(xLength, xMinor, adx, xxMinor);
+    yLength = scaleExpansion(4, bc, ady, yMinor);
+    yyLength = scaleExpansion(yLength, yMinor, ady, yyMinor);
+    int aLength = sumExpansions(xxLength, xxMinor, yyLength, yyMinor, aDet);
+
+    xLength = scaleExpansion(4, ca, bdx, xMinor);
+    xxLength = scaleExpansion(xLength, xMinor, bdx, xxMinor);
+    yLength = scaleExpansion(4, ca, bdy, yMinor);
+    yyLength = scaleExpansion(yLength, yMinor, bdy, yyMinor);
+    int bLength = sumExpansions(xxLength, xxMinor, yyLength, yyMinor, bDet);
+
+    xLength = scaleExpansion(4, ab, cdx, xMinor);
+    xxLength = scaleExpansion(xLength, xMinor, cdx, xxMinor);
+    yLength = scaleExpansion(4, ab, cdy, yMinor);
+    yyLength = scaleExpansion(yLength, yMinor, cdy, yyMinor);
+    int cLength = sumExpansions(xxLength, xxMinor, yyLength, yyMinor, cDet);
+
+    double final1[1152], final2[1152];
+    int abLength = sumExpansions(aLength, aDet, bLength, bDet, abDet);
+    int finalLength = sumExpansions(abLength, abDet, cLength, cDet, final1);
+
+    double det = estimate(finalLength, final1);
+    double errorBound = INCIRCLE_ERROR_BOUND_B * permanent;
+    if (det >= errorBound || -det >= errorBound)
+    {
+        return det;
+    }
+
+    // The differences were exact, so the determinant above is exact
+    double adxTail = twoDiffTail(ax, dx, adx), adyTail = twoDiffTail(ay, dy, ady);
+    double bdxTail = twoDiffTail(bx, dx, bdx), bdyTail = twoDiffTail(by, dy, bdy);
+    double cdxTail = twoDiffTail(cx, dx, cdx), cdyTail = twoDiffTail(cy, dy, cdy);
+    if (adxTail == 0.0 && bdxTail == 0.0 && cdxTail == 0.0 && adyTail == 0.0 && bdyTail == 0.0 && cdyTail == 0.0)
+    {
+        return det;
+    }
+
+    // Stage C: add the first-order terms of the differences' rounding errors in double precision
+    errorBound = INCIRCLE_ERROR_BOUND_C * permanent + RESULT_ERROR_BOUND * fabs(det);
+    det += ((adx * adx + ady * ady) * ((bdx * cdyTail + cdy * bdxTail) - (bdy * cdxTail + cdx * bdyTail)) +
+            2.0 * (adx * adxTail + ady * adyTail) * (bdx * cdy - bdy * cdx)) +
+           ((bdx * bdx + bdy * bdy) * ((cdx * adyTail + ady * cdxTail) - (cdy * adxTail + adx * cdyTail)) +
+            2.0 * (bdx * bdxTail + bdy * bdyTail) * (cdx * ady - cdy * adx)) +
+           ((cdx * cdx + cdy * cdy) * ((adx * bdyTail + bdy * adxTail) - (ady * bdxTail + bdx * adyTail)) +
+            2.0 * (cdx * cdxTail + cdy * cdyTail) * (adx * bdy - ady * bdx));
+    if (det >= errorBound || -det >= errorBound)
+    {
+        return det;
+    }
+
+    // Stage D: add every remaining term exactly to the stage B determinant
+    double *total = final1, *spare = final2;
+    bool aTail = (adxTail != 0.0 || adyTail != 0.0);
+    bool bTail = (bdxTail != 0.0 || bdyTail != 0.0);
+    bool cTail = (cdxTail != 0.0 || cdyTail != 0.0);
+
+    // Exact lifts of the rounded differences, needed only next to the tails of another point
+    double aa[4], bb[4], cc[4];
+    double square1, square0, otherSquare1, otherSquare0;
+    if (bTail || cTail)
+    {
+        twoSquare(adx, square1, square0);
+        twoSquare(ady, otherSquare1, otherSquare0);
+        twoTwoSum(square1, square0, otherSquare1, otherSquare0, aa);
+    }
+    if (cTail || aTail)
+    {
+        twoSquare(bdx, square1, square0);
+        twoSquare(bdy, otherSquare1, otherSquare0);
+        twoTwoSum(square1, square0, otherSquare1, otherSquare0, bb);
+    }
+    if (aTail || bTail)
+    {
+        twoSquare(cdx, square1, square0);
+        twoSquare(cdy, otherSquare1, otherSquare0);
+        twoTwoSum(square1, square0, otherSquare1, otherSquare0, cc);
+    }
+
+    double temp8[8], temp16a[16], temp16b[16], temp16c[16];
+    double temp32a[32], temp32b[32], temp48[48], temp64[64];
+    int temp8Length, temp16aLength, temp16bLength, temp16cLength;
+    int temp32aLength, temp32bLength, temp48Length, temp64Length;
+
+    // Terms linear in one tail: tail * (2 * difference * minor + lift of one neighbor * difference - lift of the other * difference)
+    double axtbc[8], aytbc[8], bxtca[8], bytca[8], cxtab[8], cytab[8];
+    int axtbcLength = 0, aytbcLength = 0, bxtcaLength = 0, bytcaLength = 0, cxtabLength = 0, cytabLength = 0;
+    auto addLinearTerm = [&](const double minor[4], double tail, double difference, double *tailMinor, int &tailMinorLength,
+                             const double firstLift[4], double firstFactor, const double secondLift[4], double secondFactor)
+    {
+        double tailLift[8];
+        tailMinorLength = scaleExpansion(4, minor, tail, tailMinor);
+        temp16aLength = scaleExpansion(tailMinorLength, tailMinor, 2.0 * difference, temp16a);
+        int tailLiftLength = scaleExpansion(4, firstLift, tail, tailLift);
+        temp16bLength = scaleExpansion(tailLiftLength, tailLift, firstFactor, temp16b);
+        tailLiftLength = scaleExpansion(4, secondLift, tail, tailLift);
+        temp16cLength = scaleExpansion(tailLiftLength, tailLift, secondFactor, temp16c);
+        temp32aLength = sumExpansions(temp16aLength, temp16a, temp16bLength, temp16b, temp32a);
+        temp48Length = sumExpansions(temp16cLength, temp16c, temp32aLength, temp32a, temp48);
+        accumulate(total, spare, finalLength, temp48Length, temp48);
+    };
+    if (adxTail != 0.0)
+    {
+        addLinearTerm(bc, adxTail, adx, axtbc, axtbcLength, cc, bdy, bb, -cdy);
+    }
+    if (adyTail != 0.0)
+    {
+        addLinearTerm(bc, adyTail, ady, aytbc, aytbcLength, bb, cdx, cc, -bdx);
+    }
+    if (bdxTail != 0.0)
+    {
+        addLinearTerm(ca, bdxTail, bdx, bxtca, bxtcaLength, aa, cdy, cc, -ady);
+    }
+    if (bdyTail != 0.0)
+    {
+        addLinearTerm(ca, bdyTail, bdy, bytca, bytcaLength, cc, adx, aa, -cdx);
+    }
+    if (cdxTail != 0.0)
+    {
+        addLinearTerm(ab, cdxTail, cdx, cxtab, cxtabLength, bb, ady, aa, -bdy);
+    }
+    if (cdyTail != 0.0)
+    {
+        addLinearTerm(ab, cdyTail, cdy, cytab, cytabLength, aa, bdx, bb, -adx);
+    }
+
+    // Terms of higher order in the tails, one point at a time. minorTail holds the minor's terms linear in the
+    // tails of the other two points and minorTailTail its term quadratic in them.
+    auto addHigherTerms = [&](double tail, double difference, const double *tailMinor, int tailMinorLength, const double *minorTail,
+                              int minorTailLength, const double *minorTailTail, int minorTailTailLength)
+    {
+        double tailMinorTail[16], tailMinorTailTail[8];
+        temp16aLength = scaleExpansion(tailMinorLength, tailMinor, tail, temp16a);
+        int tailMinorTailLength = scaleExpansion(minorTailLength, minorTail, tail, tailMinorTail);
+        temp32aLength = scaleExpansion(tailMinorTailLength, tailMinorTail, 2.0 * difference, temp32a);
+        temp48Length = sumExpansions(temp16aLength, temp16a, temp32aLength, temp32a, temp48);
+        accumulate(total, spare, finalLength, temp48Length, temp48);
+
+        temp32aLength = scaleExpansion(tailMinorTailLength, tailMinorTail, tail, temp32a);
+        int tailMinorTailTailLength = scaleExpansion(minorTailTailLength, minorTailTail, tail, tailMinorTailTail);
+        temp16aLength = scaleExpansion(tailMinorTailTailLength, tailMinorTailTail, 2.0 * difference, temp16a);
+        temp16bLength = scaleExpansion(tailMinorTailTailLength, tailMinorTailTail, tail, temp16b);
+        temp32bLength = sumExpansions(temp16aLength, temp16a, temp16bLength, temp16b, temp32b);
+        temp64Length = sumExpansions(temp32aLength, temp32a, temp32bLength, temp32b, temp64);
+        accumulate(total, spare, finalLength, temp64Length, temp64);
+    };
+
+    // Product of an x-tail, a y-tail of another point and the exact lift of the third
+    auto addCrossTerm = [&](const double lift[4], double xTail, double yTail)
+    {
+        temp8Length = scaleExpansion(4, lift, xTail, temp8);
+        temp16aLength = scaleExpansion(temp8Length, temp8, yTail, temp16a);
+        accumulate(total, spare, finalLength, temp16aLength, temp16a);
+    };
+
+    // The tail terms of a minor from the tails of its two points: first * second' - second * first' style pairs
+    auto buildMinorTails = [&](bool otherTails, double pxTail, double qy, double px, double qyTail, double rxTail, double py,
+                               double rx, double pyTail, double *minorTail, int &minorTailLength, double minorTailTail[4],
+                               int &minorTailTailLength)
+    {
+        if (!otherTails)
+        {
+            minorTail[0] = 0.0;
+            minorTailLength = 1;
+            minorTailTail[0] = 0.0;
+            minorTailTailLength = 1;
+            return;
+        }
+        double i1, i0, j1, j0, u[4], v[4];
+        twoProduct(pxTail, qy, i1, i0);
+        twoProduct(px, qyTail, j1, j0);
+        twoTwoSum(i1, i0, j1, j0, u);
+        twoProduct(rxTail, -py, i1, i0);
+        twoProduct(rx, -pyTail, j1, j0);
+        twoTwoSum(i1, i0, j1, j0, v);
+        minorTailLength = sumExpansions(4, u, 4, v, minorTail);
+
+        twoProduct(pxTail, qyTail, i1, i0);
+        twoProduct(rxTail, pyTail, j1, j0);
+        twoTwoDiff(i1, i0, j1, j0, minorTailTail);
+        minorTailTailLength = 4;
+    };
+
+    double minorTail[8], minorTailTail[4];
+    int minorTailLength, minorTailTailLength;
+    if (aTail)
+    {
+        buildMinorTails(bTail || cTail, bdxTail, cdy, bdx, cdyTail, cdxTail, bdy, cdx, bdyTail, minorTail, minorTailLength,
+                        minorTailTail, minorTailTailLength);
+        if (adxTail != 0.0)
+        {
+            addHigherTerms(adxTail, adx, axtbc, axtbcLength, minorTail, minorTailLength, minorTailTail, minorTailTailLength);
+            if (bdyTail != 0.0)
+            {
+                addCrossTerm(cc, adxTail, bdyTail);
+            }
+            if (cdyTail != 0.0)
+            {
+                addCrossTerm(bb, -adxTail, cdyTail);
+            }
+        }
+        if (adyTail != 0.0)
+        {
+            addHigherTerms(adyTail, ady, aytbc, aytbcLength, minorTail, minorTailLength, minorTailTail, minorTailTailLength);
+        }
+    }
+    if (bTail)
+    {
+        buildMinorTails(cTail || aTail, cdxTail, ady, cdx, adyTail, adxTail, cdy, adx, cdyTail, minorTail, minorTailLength,
+                        minorTailTail, minorTailTailLength);
+        if (bdxTail != 0.0)
+        {
+            addHigherTerms(bdxTail, bdx, bxtca, bxtcaLength, minorTail, minorTailLength, minorTailTail, minorTailTailLength);
+            if (cdyTail != 0.0)
+            {
+                addCrossTerm(aa, bdxTail, cdyTail);
+            }
+            if (adyTail != 0.0)
+            {
+                addCrossTerm(cc, -bdxTail, adyTail);
+            }
+        }
+        if (bdyTail != 0.0)
+        {
+            addHigherTerms(bdyTail, bdy, bytca, bytcaLength, minorTail, minorTailLength, minorTailTail, minorTailTailLength);
+        }
+    }
+    if (cTail)
+    {
+        buildMinorTails(aTail || bTail, adxTail, bdy, adx, bdyTail, bdxTail, ady, bdx, adyTail, minorTail, minorTailLength,
+                        minorTailTail, minorTailTailLength);
+        if (cdxTail != 0.0)
+        {
+            addHigherTerms(cdxTail, cdx, cxtab, cxtabLength, minorTail, minorTailLength, minorTailTail, minorTailTailLength);
+            if (adyTail != 0.0)
+            {
+                addCrossTerm(bb, cdxTail, adyTail);
+            }
+            if (bdyTail != 0.0)
+            {
+                addCrossTerm(aa, -cdxTail, bdyTail);
+            }
+        }
+        if (cdyTail != 0.0)
+        {
+            addHigherTerms(cdyTail, cdy, cytab, cytabLength, minorTail, minorTailLength, minorTailTail, minorTailTailLength);
+        }
+    }
+
+    return total[finalLength - 1];
+}
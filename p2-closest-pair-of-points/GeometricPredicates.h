@@ -0,0 +1,58 @@
+/*
+ * @file GeometricPredicates.h
+ * @brief Declaration of the GeometricPredicates class, robust orientation and in-circle tests.
+ *
+ * This file contains the declaration of the GeometricPredicates class, which provides the orientation and
+ * in-circle tests used by the Delaunay triangulation. Each test is first evaluated in double precision
+ * together with a bound on its rounding error. Only when the result is too close to zero to trust is the
+ * determinant refined, in stages of increasing precision, with floating-point expansion arithmetic, so the
+ * sign is always correct and nearly degenerate inputs pay only for the precision they need.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+/*
+ * @brief Class providing robust geometric predicates on points in the plane.
+ */
+class GeometricPredicates
+{
+public:
+    /*
+     * @brief Orientation test for three points.
+     * @return A positive value if a, b, c are in counterclockwise order, negative if clockwise, zero if collinear.
+     * @pre The coordinates are finite.
+     * @post The sign of the returned value is exact.
+     */
+    static double orient2d(double ax, double ay, double bx, double by, double cx, double cy);
+
+    /*
+     * @brief In-circle test for four points.
+     * @return A positive value if d lies inside the circle through a, b, c (given in counterclockwise order),
+     *         negative if outside, zero if the four points are cocircular.
+     * @pre The coordinates are finite.
+     * @post The sign of the returned value is exact.
+     */
+    static double incircle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy);
+
+private:
+    /*
+     * @brief Orientation determinant refined in stages until its sign is certain.
+     * @param detSum The sum of the magnitudes of the two products of the double-precision determinant.
+     * @return A value with the exact sign of the orientation determinant.
+     * @pre The coordinates are finite and the double-precision determinant was too close to zero to trust.
+     * @post None.
+     */
+    static double orient2dAdaptive(double ax, double ay, double bx, double by, double cx, double cy, double detSum);
+
+    /*
+     * @brief In-circle determinant refined in stages until its sign is certain.
+     * @param permanent The permanent of the double-precision determinant, which bounds its rounding error.
+     * @return A value with the exact sign of the in-circle determinant.
+     * @pre The coordinates are finite and the double-precision determinant was too close to zero to trust.
+     * @post None.
+     */
+    static double incircleAdaptive(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy,
+                                   double permanent);
+};
@@ -0,0 +1,256 @@
+/*
+ * @file KdTree.cpp
+ * @brief Implementation of the KdTree class, a static 2D tree for nearest neighbor queries.
+ *
+ * This file contains the implementation of the KdTree class. The tree is built by repeatedly placing the
+ * median of each range (by nth_element) at its middle position, alternating between the x- and y-axis.
+ * Ranges of at most LEAF_SIZE points are left unsplit and scanned linearly during queries.
+ *
+ * @author Phat Tran
+ */
+
+#include "KdTree.h"
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+using namespace std;
+
+// Ranges with at most this many points are scanned linearly instead of being split
+const int LEAF_SIZE = 8;
+
+/*
+ * @brief Constructor for KdTree class.
+ * @param points The points to index, such as a PointSet.
+ * @pre None.
+ * @post A KdTree object is built over every point of the set.
+ */
+KdTree::KdTree(const PointSpan &points)
+{
+    vector<double> pointXs(points.size());
+    vector<double> pointYs(points.size());
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        pointXs[i] = points.getX(i);
+        pointYs[i] = points.getY(i);
+    }
+    initialize(pointXs, pointYs);
+}
+
+/*
+ * @brief Constructor for KdTree class from coordinate arrays.
+ * @param xs The x-coordinates of the points.
+ * @param ys The y-coordinates of the points.
+ * @pre xs and ys have the same length.
+ * @post A KdTree object is built over every point; point i is reported with index i.
+ */
+KdTree::KdTree(const vector<double> &xs, const vector<double> &ys)
+{
+    initialize(xs, ys);
+}
+
+/*
+ * @brief Constructor for KdTree class from arrays already in tree order.
+ * @param treeXs The x-coordinates in tree order, as reported by getX of an existing tree.
+ * @param treeYs The y-coordinates in tree order, as reported by getY of an existing tree.
+ * @param treeIds The input indices in tree order, as reported by getIndex of an existing tree.
+ * @pre The arrays have the same length and were taken from a tree built by one of the other constructors.
+ * @post A KdTree object equal to the original tree is restored without rebuilding it.
+ */
+KdTree::KdTree(const vector<double> &treeXs, const vector<double> &treeYs, const vector<int> &treeIds)
+    : xs(treeXs), ys(treeYs), ids(treeIds) {}
+
+/*
+ * @brief Destructor for KdTree class.
+ * @pre None.
+ * @post The KdTree object and its associated resources are deallocated.
+ */
+KdTree::~KdTree() {}
+
+/*
+ * @brief Build the tree over coordinate arrays.
+ * @param xs The x-coordinates of the points.
+ * @param ys The y-coordinates of the points.
+ * @pre xs and ys have the same length.
+ * @post The tree holds every point in tree order; point i is reported with index i.
+ */
+void KdTree::initialize(const vector<double> &xs, const vector<double> &ys)
+{
+    this->xs = xs;
+    this->ys = ys;
+
+    // Build the tree over a permutation, then lay the coordinates out in tree order
+    vector<int> order(xs.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        order[i] = static_cast<int>(i);
+    }
+    build(order, 0, static_cast<int>(order.size()), 0);
+
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        this->xs[i] = xs[order[i]];
+        this->ys[i] = ys[order[i]];
+    }
+    this->ids = order;
+}
+
+/*
+ * @brief Find the point nearest to a query location.
+ * @param x The x-coordinate of the query location.
+ * @param y The y-coordinate of the query location.
+ * @param excludeIndex The input index of a point to ignore (usually the query point itself), or -1.
+ * @param distance Receives the distance to the nearest point, or the maximum possible distance if none.
+ * @param maxDistance Only points strictly closer than this distance are reported, optional with no limit by default.
+ * @return The input index of the nearest point, or -1 if the tree has no eligible point.
+ * @pre None.
+ * @post No side effects on the tree.
+ */
+int KdTree::findNearest(double x, double y, int excludeIndex, double &distance, double maxDistance) const
+{
+    // A finite bound lets the search prune every subtree farther away than it
+    int bestIndex = -1;
+    double bestSquaredDistance = (maxDistance < sqrt(numeric_limits<double>::max())) ? maxDistance * maxDistance : numeric_limits<double>::max();
+    searchNearest(x, y, excludeIndex, 0, static_cast<int>(this->ids.size()), 0, bestIndex, bestSquaredDistance);
+
+    distance = (bestIndex < 0) ? numeric_limits<double>::max() : sqrt(bestSquaredDistance);
+    return bestIndex;
+}
+
+/*
+ * @brief Get the number of points in the tree.
+ * @return The number of points.
+ * @pre None.
+ * @post The number of points is returned.
+ */
+size_t KdTree::size() const
+{
+    return this->ids.size();
+}
+
+/*
+ * @brief Get the x-coordinate of the point stored at a tree position.
+ * @param position The tree position, from 0 to size() - 1.
+ * @return The x-coordinate.
+ * @pre position is a valid tree position.
+ * @post The x-coordinate is returned.
+ */
+double KdTree::getX(size_t position) const
+{
+    return this->xs[position];
+}
+
+/*
+ * @brief Get the y-coordinate of the point stored at a tree position.
+ * @param position The tree position, from 0 to size() - 1.
+ * @return The y-coordinate.
+ * @pre position is a valid tree position.
+ * @post The y-coordinate is returned.
+ */
+double KdTree::getY(size_t position) const
+{
+    return this->ys[position];
+}
+
+/*
+ * @brief Get the input index of the point stored at a tree position.
+ * @param position The tree position, from 0 to size() - 1.
+ * @return The index of the point in the input.
+ * @pre position is a valid tree position.
+ * @post The input index is returned.
+ */
+int KdTree::getIndex(size_t position) const
+{
+    return this->ids[position];
+}
+
+/*
+ * @brief Reorder a range of points into tree order.
+ * @param order Input indices of the points, permuted in place.
+ * @param leftIndex Index of the first point of the range.
+ * @param rightIndex Index one past the last point of the range.
+ * @param depth Depth of the range in the tree; even depths split on x, odd depths on y.
+ * @pre The range is within order.
+ * @post The median of the range splits it on the depth's axis, recursively.
+ */
+void KdTree::build(vector<int> &order, int leftIndex, int rightIndex, int depth)
+{
+    if (rightIndex - leftIndex <= LEAF_SIZE)
+    {
+        return;
+    }
+
+    // Place the median of the range on the depth's axis at the middle position
+    int mid = (leftIndex + rightIndex) / 2;
+    const vector<double> &axis = (depth % 2 == 0) ? this->xs : this->ys;
+    nth_element(order.begin() + leftIndex, order.begin() + mid, order.begin() + rightIndex,
+                [&axis](int a, int b)
+                { return axis[a] < axis[b]; });
+
+    build(order, leftIndex, mid, depth + 1);
+    build(order, mid + 1, rightIndex, depth + 1);
+}
+
+/*
+ * @brief Recursive nearest neighbor search.
+ * @param x The x-coordinate of the query location.
+ * @param y The y-coordinate of the query location.
+ * @param excludeIndex The input index of a point to ignore, or -1.
+ * @param leftIndex Index of the first point of the range.
+ * @param rightIndex Index one past the last point of the range.
+ * @param depth Depth of the range in the tree.
+ * @param bestIndex The input index of the nearest point found so far.
+ * @param bestSquaredDistance The squared distance to the nearest point found so far.
+ * @pre None.
+ * @post bestIndex and bestSquaredDistance account for every point of the range.
+ */
+void KdTree::searchNearest(double x, double y, int excludeIndex, int leftIndex, int rightIndex, int depth,
+                           int &bestIndex, double &bestSquaredDistance) const
+{
+    // Leaf: scan every point of the range
+    if (rightIndex - leftIndex <= LEAF_SIZE)
+    {
+        for (int i = leftIndex; i < rightIndex; i++)
+        {
+            double dx = this->xs[i] - x;
+            double dy = this->ys[i] - y;
+            double squaredDistance = dx * dx + dy * dy;
+            if (squaredDistance < bestSquaredDistance && this->ids[i] != excludeIndex)
+            {
+                bestSquaredDistance = squaredDistance;
+                bestIndex = this->ids[i];
+            }
+        }
+        return;
+    }
+
+    // Check the median point itself
+    int mid = (leftIndex + rightIndex) / 2;
+    double dx = this->xs[mid] - x;
+    double dy = this->ys[mid] - y;
+    double squaredDistance = dx * dx + dy * dy;
+    if (squaredDistance < bestSquaredDistance && this->ids[mid] != excludeIndex)
+    {
+        bestSquaredDistance = squaredDistance;
+        bestIndex = this->ids[mid];
+    }
+
+    // Search the side containing the query first, then the other side if the splitting line is close enough
+    double offset = (depth % 2 == 0) ? x - this->xs[mid] : y - this->ys[mid];
+    if (offset < 0)
+    {
+        searchNearest(x, y, excludeIndex, leftIndex, mid, depth + 1, bestIndex, bestSquaredDistance);
+        if (offset * offset < bestSquaredDistance)
+        {
+            searchNearest(x, y, excludeIndex, mid + 1, rightIndex, depth + 1, bestIndex, bestSquaredDistance);
+        }
+    }
+    else
+    {
+        searchNearest(x, y, excludeIndex, mid + 1, rightIndex, depth + 1, bestIndex, bestSquaredDistance);
+        if (offset * offset < bestSquaredDistance)
+        {
+            searchNearest(x, y, excludeIndex, leftIndex, mid, depth + 1, bestIndex, bestSquaredDistance);
+        }
+    }
+}
@@ -0,0 +1,150 @@
+/*
+ * @file KdTree.h
+ * @brief Declaration of the KdTree class, a static 2D tree for nearest neighbor queries.
+ *
+ * This file contains the declaration of the KdTree class, which stores the points of a PointSet in an
+ * implicit balanced 2D tree. The tree alternates between splitting on the x- and y-coordinate at the
+ * median of each range, so no child pointers are stored. Coordinates are kept in separate arrays in
+ * tree order, and small ranges are scanned linearly. Queries report points by their position in the
+ * input PointSet.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include "PointSpan.h"
+#include <limits>
+#include <vector>
+
+/*
+ * @brief Class representing a static 2D tree over a set of points.
+ */
+class KdTree
+{
+public:
+    /*
+     * @brief Constructor for KdTree class.
+     * @param points The points to index, such as a PointSet.
+     * @pre None.
+     * @post A KdTree object is built over every point of the set.
+     */
+    explicit KdTree(const PointSpan &points);
+
+    /*
+     * @brief Constructor for KdTree class from coordinate arrays.
+     * @param xs The x-coordinates of the points.
+     * @param ys The y-coordinates of the points.
+     * @pre xs and ys have the same length.
+     * @post A KdTree object is built over every point; point i is reported with index i.
+     */
+    KdTree(const std::vector<double> &xs, const std::vector<double> &ys);
+
+    /*
+     * @brief Constructor for KdTree class from arrays already in tree order.
+     * @param treeXs The x-coordinates in tree order, as reported by getX of an existing tree.
+     * @param treeYs The y-coordinates in tree order, as reported by getY of an existing tree.
+     * @param treeIds The input indices in tree order, as reported by getIndex of an existing tree.
+     * @pre The arrays have the same length and were taken from a tree built by one of the other constructors.
+     * @post A KdTree object equal to the original tree is restored without rebuilding it.
+     */
+    KdTree(const std::vector<double> &treeXs, const std::vector<double> &treeYs, const std::vector<int> &treeIds);
+
+    /*
+     * @brief Destructor for KdTree class.
+     * @pre None.
+     * @post The KdTree object and its associated resources are deallocated.
+     */
+    ~KdTree();
+
+    /*
+     * @brief Find the point nearest to a query location.
+     * @param x The x-coordinate of the query location.
+     * @param y The y-coordinate of the query location.
+     * @param excludeIndex The input index of a point to ignore (usually the query point itself), or -1.
+     * @param distance Receives the distance to the nearest point, or the maximum possible distance if none.
+     * @param maxDistance Only points strictly closer than this distance are reported, optional with no limit by default.
+     * @return The input index of the nearest point, or -1 if the tree has no eligible point.
+     * @pre None.
+     * @post No side effects on the tree.
+     */
+    int findNearest(double x, double y, int excludeIndex, double &distance,
+                    double maxDistance = std::numeric_limits<double>::max()) const;
+
+    /*
+     * @brief Get the number of points in the tree.
+     * @return The number of points.
+     * @pre None.
+     * @post The number of points is returned.
+     */
+    size_t size() const;
+
+    /*
+     * @brief Get the x-coordinate of the point stored at a tree position.
+     * @param position The tree position, from 0 to size() - 1.
+     * @return The x-coordinate.
+     * @pre position is a valid tree position.
+     * @post The x-coordinate is returned.
+     */
+    double getX(size_t position) const;
+
+    /*
+     * @brief Get the y-coordinate of the point stored at a tree position.
+     * @param position The tree position, from 0 to size() - 1.
+     * @return The y-coordinate.
+     * @pre position is a valid tree position.
+     * @post The y-coordinate is returned.
+     */
+    double getY(size_t position) const;
+
+    /*
+     * @brief Get the input index of the point stored at a tree position.
+     * @param position The tree position, from 0 to size() - 1.
+     * @return The index of the point in the input.
+     * @pre position is a valid tree position.
+     * @post The input index is returned.
+     */
+    int getIndex(size_t position) const;
+
+private:
+    /*
+     * @brief Build the tree over coordinate arrays.
+     * @param xs The x-coordinates of the points.
+     * @param ys The y-coordinates of the points.
+     * @pre xs and ys have the same length.
+     * @post The tree holds every point in tree order; point i is reported with index i.
+     */
+    void initialize(const std::vector<double> &xs, const std::vector<double> &ys);
+
+    /*
+     * @brief Reorder a range of points into tree order.
+     * @param order Input indices of the points, permuted in place.
+     * @param leftIndex Index of the first point of the range.
+     * @param rightIndex Index one past the last point of the range.
+     * @param depth Depth of the range in the tree; even depths split on x, odd depths on y.
+     * @pre The range is within order.
+     * @post The median of the range splits it on the depth's axis, recursively.
+     */
+    void build(std::vector<int> &order, int leftIndex, int rightIndex, int depth);
+
+    /*
+     * @brief Recursive nearest neighbor search.
+     * @param x The x-coordinate of the query location.
+     * @param y The y-coordinate of the query location.
+     * @param excludeIndex The input index of a point to ignore, or -1.
+     * @param leftIndex Index of the first point of the range.
+     * @param rightIndex Index one past the last point of the range.
+     * @param depth Depth of the range in the tree.
+     * @param bestIndex The input index of the nearest point found so far.
+     * @param bestSquaredDistance The squared distance to the nearest point found so far.
+     * @pre None.
+     * @post bestIndex and bestSquaredDistance account for every point of the range.
+     */
+    void searchNearest(double x, double y, int excludeIndex, int leftIndex, int rightIndex, int depth,
+                       int &bestIndex, double &bestSquaredDistance) const;
+
+    std::vector<double> xs; // x-coordinates in tree order.
+    std::vector<double> ys; // y-coordinates in tree order.
+    std::vector<int> ids;   // Input indices in tree order.
+};
@@ -23,6 +23,8 @@ private:
     double x;  // x-coordinate of the point in a 2D space.
     double y;  // y-coordinate of the point in a 2D space.
 
+    friend class PointSpan; // Views the coordinates of a PointSet in place.
+
 public:
     /*
      * @brief Constructor for Point class.
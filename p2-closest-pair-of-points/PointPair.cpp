@@ -0,0 +1,86 @@
+/*
+ * @file PointPair.cpp
+ * @brief Implementation of the PointPair class methods.
+ *
+ * This file contains the implementation of the PointPair class methods, including constructors, getter
+ * functions, a comparison operator used to order pairs by distance, and a destructor.
+ *
+ * @author Phat Tran
+ */
+
+#include "PointPair.h"
+#include <limits>
+
+using namespace std;
+
+/*
+ * @brief Default constructor for PointPair class.
+ * @pre None.
+ * @post An empty PointPair object is created with indices -1 and the maximum possible distance.
+ */
+PointPair::PointPair() : firstIndex(-1), secondIndex(-1), distance(numeric_limits<double>::max()) {}
+
+/*
+ * @brief Constructor for PointPair class.
+ * @param firstIndex The original input index of the first point.
+ * @param secondIndex The original input index of the second point.
+ * @param distance The distance between the two points.
+ * @pre None.
+ * @post A PointPair object is created with the smaller index stored first.
+ */
+PointPair::PointPair(int firstIndex, int secondIndex, double distance)
+    : firstIndex(firstIndex < secondIndex ? firstIndex : secondIndex),
+      secondIndex(firstIndex < secondIndex ? secondIndex : firstIndex),
+      distance(distance) {}
+
+/*
+ * @brief Destructor for PointPair class.
+ * @pre None.
+ * @post The PointPair object and its associated resources are deallocated.
+ */
+PointPair::~PointPair() {}
+
+/*
+ * @brief Get the original input index of the first point.
+ * @return The index of the first point.
+ * @pre The PointPair object must exist.
+ * @post The index of the first point is returned.
+ */
+int PointPair::getFirstIndex() const
+{
+    return this->firstIndex;
+}
+
+/*
+ * @brief Get the original input index of the second point.
+ * @return The index of the second point.
+ * @pre The PointPair object must exist.
+ * @post The index of the second point is returned.
+ */
+int PointPair::getSecondIndex() const
+{
+    return this->secondIndex;
+}
+
+/*
+ * @brief Get the distance between the two points.
+ * @return The distance between the two points.
+ * @pre The PointPair object must exist.
+ * @post The distance between the two points is returned.
+ */
+double PointPair::getDistance() const
+{
+    return this->distance;
+}
+
+/*
+ * @brief Compare two pairs based on their distances.
+ * @param other The pair to compare against.
+ * @return True if this pair is closer than the other pair, false otherwise.
+ * @pre Both pairs must be valid PointPair objects.
+ * @post No side effects on either pair.
+ */
+bool PointPair::operator<(const PointPair &other) const
+{
+    return this->distance < other.distance;
+}
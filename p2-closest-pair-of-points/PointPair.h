@@ -0,0 +1,81 @@
+/*
+ * @file PointPair.h
+ * @brief Declaration of the PointPair class, representing a pair of points and the distance between them.
+ *
+ * This file defines the PointPair class, which identifies two points by their original input indices and
+ * stores the distance between them. It includes constructors, getter functions, a comparison operator used
+ * to order pairs by distance, and a destructor.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+/*
+ * @brief Class representing a pair of points identified by their original input indices.
+ */
+class PointPair
+{
+private:
+    int firstIndex;  // Original input index of the first point in the pair.
+    int secondIndex; // Original input index of the second point in the pair.
+    double distance; // Distance between the two points.
+
+public:
+    /*
+     * @brief Default constructor for PointPair class.
+     * @pre None.
+     * @post An empty PointPair object is created with indices -1 and the maximum possible distance.
+     */
+    PointPair();
+
+    /*
+     * @brief Constructor for PointPair class.
+     * @param firstIndex The original input index of the first point.
+     * @param secondIndex The original input index of the second point.
+     * @param distance The distance between the two points.
+     * @pre None.
+     * @post A PointPair object is created with the smaller index stored first.
+     */
+    PointPair(int firstIndex, int secondIndex, double distance);
+
+    /*
+     * @brief Destructor for PointPair class.
+     * @pre None.
+     * @post The PointPair object and its associated resources are deallocated.
+     */
+    ~PointPair();
+
+    /*
+     * @brief Get the original input index of the first point.
+     * @return The index of the first point.
+     * @pre The PointPair object must exist.
+     * @post The index of the first point is returned.
+     */
+    int getFirstIndex() const;
+
+    /*
+     * @brief Get the original input index of the second point.
+     * @return The index of the second point.
+     * @pre The PointPair object must exist.
+     * @post The index of the second point is returned.
+     */
+    int getSecondIndex() const;
+
+    /*
+     * @brief Get the distance between the two points.
+     * @return The distance between the two points.
+     * @pre The PointPair object must exist.
+     * @post The distance between the two points is returned.
+     */
+    double getDistance() const;
+
+    /*
+     * @brief Compare two pairs based on their distances.
+     * @param other The pair to compare against.
+     * @return True if this pair is closer than the other pair, false otherwise.
+     * @pre Both pairs must be valid PointPair objects.
+     * @post No side effects on either pair.
+     */
+    bool operator<(const PointPair &other) const;
+};
@@ -0,0 +1,59 @@
+/*
+ * @file PointSpan.cpp
+ * @brief Implementation of the PointSpan class, a non-owning view of points held in caller-owned memory.
+ *
+ * This file contains the implementation of the PointSpan class. A view only records where the coordinates
+ * of its first point are and how far apart consecutive points are. A view of a PointSet points into the
+ * x and y members of its Point objects, which PointSpan may read as a friend of Point.
+ *
+ * @author Phat Tran
+ */
+
+#include "PointSpan.h"
+
+using namespace std;
+
+/*
+ * @brief Constructor for PointSpan class over coordinate arrays.
+ * @param xs Address of the first point's x-coordinate.
+ * @param ys Address of the first point's y-coordinate.
+ * @param size The number of points.
+ * @param stride The number of bytes from one point's coordinate to the next one's, optional with packed arrays of doubles by default.
+ * @pre Both addresses stay valid, and the memory unchanged, for as long as the view is used.
+ * @post A view of the points is created; point i is read at xs and ys advanced by i * stride bytes.
+ */
+PointSpan::PointSpan(const double *xs, const double *ys, size_t size, size_t stride)
+    : xs(reinterpret_cast<const char *>(xs)), ys(reinterpret_cast<const char *>(ys)), count(size), stride(stride) {}
+
+/*
+ * @brief Constructor for PointSpan class over the points of a PointSet.
+ * @param pointSet The set of points to view.
+ * @pre The PointSet is neither resized nor destroyed for as long as the view is used.
+ * @post A view of the points of the set is created, in the same order.
+ */
+PointSpan::PointSpan(const PointSet &pointSet) : xs(nullptr), ys(nullptr), count(pointSet.size()), stride(sizeof(Point))
+{
+    if (this->count > 0)
+    {
+        this->xs = reinterpret_cast<const char *>(&pointSet[0].x);
+        this->ys = reinterpret_cast<const char *>(&pointSet[0].y);
+    }
+}
+
+/*
+ * @brief Destructor for PointSpan class.
+ * @pre None.
+ * @post The view is released; the viewed memory is left untouched.
+ */
+PointSpan::~PointSpan() {}
+
+/*
+ * @brief Get the number of points in the view.
+ * @return The number of points.
+ * @pre None.
+ * @post The number of points is returned.
+ */
+size_t PointSpan::size() const
+{
+    return this->count;
+}
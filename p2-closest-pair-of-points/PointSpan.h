@@ -0,0 +1,89 @@
+/*
+ * @file PointSpan.h
+ * @brief Declaration of the PointSpan class, a non-owning view of points held in caller-owned memory.
+ *
+ * This file contains the declaration of the PointSpan class, which reads the x- and y-coordinates of a
+ * sequence of points straight out of memory that someone else owns: two separate coordinate arrays, an
+ * array of structures with a byte stride, or the points of a PointSet. Nothing is copied when a view is
+ * made, so points held in a memory-mapped file or a shared-memory buffer can be searched without building
+ * Point objects. The closest pair engines take their input as a PointSpan; since a PointSet converts to a
+ * PointSpan implicitly, existing callers keep passing PointSets unchanged.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include <cstddef>
+
+/*
+ * @brief Class representing a read-only view of points in caller-owned memory.
+ */
+class PointSpan
+{
+public:
+    /*
+     * @brief Constructor for PointSpan class over coordinate arrays.
+     * @param xs Address of the first point's x-coordinate.
+     * @param ys Address of the first point's y-coordinate.
+     * @param size The number of points.
+     * @param stride The number of bytes from one point's coordinate to the next one's, optional with packed arrays of doubles by default.
+     * @pre Both addresses stay valid, and the memory unchanged, for as long as the view is used.
+     * @post A view of the points is created; point i is read at xs and ys advanced by i * stride bytes.
+     */
+    PointSpan(const double *xs, const double *ys, size_t size, size_t stride = sizeof(double));
+
+    /*
+     * @brief Constructor for PointSpan class over the points of a PointSet.
+     * @param pointSet The set of points to view.
+     * @pre The PointSet is neither resized nor destroyed for as long as the view is used.
+     * @post A view of the points of the set is created, in the same order.
+     */
+    PointSpan(const PointSet &pointSet);
+
+    /*
+     * @brief Destructor for PointSpan class.
+     * @pre None.
+     * @post The view is released; the viewed memory is left untouched.
+     */
+    ~PointSpan();
+
+    /*
+     * @brief Get the number of points in the view.
+     * @return The number of points.
+     * @pre None.
+     * @post The number of points is returned.
+     */
+    size_t size() const;
+
+    /*
+     * @brief Get the x-coordinate of a point; defined here so that engine loops can inline it.
+     * @param position The position of the point in the view.
+     * @return The x-coordinate.
+     * @pre position is less than size().
+     * @post The x-coordinate is returned.
+     */
+    double getX(size_t position) const
+    {
+        return *reinterpret_cast<const double *>(this->xs + position * this->stride);
+    }
+
+    /*
+     * @brief Get the y-coordinate of a point; defined here so that engine loops can inline it.
+     * @param position The position of the point in the view.
+     * @return The y-coordinate.
+     * @pre position is less than size().
+     * @post The y-coordinate is returned.
+     */
+    double getY(size_t position) const
+    {
+        return *reinterpret_cast<const double *>(this->ys + position * this->stride);
+    }
+
+private:
+    const char *xs; // Address of the first x-coordinate.
+    const char *ys; // Address of the first y-coordinate.
+    size_t count;   // Number of points.
+    size_t stride;  // Bytes between the coordinates of consecutive points.
+};
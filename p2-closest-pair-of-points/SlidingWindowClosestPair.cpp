@@ -0,0 +1,166 @@
+/*
+ * @file SlidingWindowClosestPair.cpp
+ * @brief Implementation of the SlidingWindowClosestPair class for the closest pair of a timestamped point stream.
+ *
+ * This file contains the implementation of the SlidingWindowClosestPair class. An arrival first expires the
+ * points at the front of the queue that have left the window, then inserts the new point into the dynamic
+ * structure; both are expected O(log n) updates of DynamicClosestPair. The dynamic structure never reuses
+ * the identifiers of deleted points, so once it has handed out more than twice as many identifiers as the
+ * window holds, it is rebuilt from the window alone. The rebuild costs O(n log n) for a window of n points
+ * and happens at most once every n arrivals, so memory stays proportional to the window.
+ *
+ * @author Phat Tran
+ */
+
+#include "SlidingWindowClosestPair.h"
+#include "PointSpan.h"
+#include <iostream>
+#include <limits>
+
+using namespace std;
+
+// The dynamic structure is never rebuilt while it has handed out at most this many identifiers
+const size_t COMPACT_MINIMUM = 1024;
+
+/*
+ * @brief Constructor for SlidingWindowClosestPair class.
+ * @param windowLength The length W of the window, in the same unit as the timestamps.
+ * @pre windowLength > 0.
+ * @post An empty window is created; a point stays in it while its timestamp is greater than the latest time minus W.
+ */
+SlidingWindowClosestPair::SlidingWindowClosestPair(double windowLength)
+    : windowLength(windowLength), latestTime(-numeric_limits<double>::infinity()), arrivals(0), pairs(PointSet())
+{
+    if (!(windowLength > 0.0))
+    {
+        cerr << "Error: The window length must be positive." << endl;
+    }
+}
+
+/*
+ * @brief Destructor for SlidingWindowClosestPair class.
+ * @pre None.
+ * @post The SlidingWindowClosestPair object and its associated resources are deallocated.
+ */
+SlidingWindowClosestPair::~SlidingWindowClosestPair() {}
+
+/*
+ * @brief Add the next point of the stream.
+ * @param point The point; its index is ignored.
+ * @param timestamp The arrival time of the point.
+ * @return The position of the point in the stream, counting from 0, or -1 if the timestamp is earlier than the latest time.
+ * @pre None.
+ * @post The window is advanced to the timestamp, and then holds the point.
+ */
+long long SlidingWindowClosestPair::addPoint(const Point &point, double timestamp)
+{
+    if (!advanceTime(timestamp))
+    {
+        return -1;
+    }
+
+    if (this->streamIndices.size() > COMPACT_MINIMUM && this->streamIndices.size() > 2 * this->window.size())
+    {
+        compact();
+    }
+
+    WindowEntry entry;
+    entry.x = point.getX();
+    entry.y = point.getY();
+    entry.timestamp = timestamp;
+    entry.streamIndex = this->arrivals++;
+    entry.id = this->pairs.insertPoint(point);
+    this->window.push_back(entry);
+    this->streamIndices.push_back(entry.streamIndex);
+
+    return entry.streamIndex;
+}
+
+/*
+ * @brief Advance the window without adding a point.
+ * @param timestamp The new latest time.
+ * @return True if the window was advanced, false if the timestamp is earlier than the latest time.
+ * @pre None.
+ * @post Every point with a timestamp of at most timestamp - W has left the window.
+ */
+bool SlidingWindowClosestPair::advanceTime(double timestamp)
+{
+    if (timestamp < this->latestTime)
+    {
+        cerr << "Error: Timestamp " << timestamp << " is earlier than the latest time " << this->latestTime << "." << endl;
+        return false;
+    }
+
+    this->latestTime = timestamp;
+    expirePoints(timestamp);
+    return true;
+}
+
+/*
+ * @brief Get the closest pair of the points in the window.
+ * @param firstIndex Receives the stream position of the first point of the pair, or -1 if there is no pair.
+ * @param secondIndex Receives the stream position of the second point of the pair, or -1 if there is no pair.
+ * @return The distance between the two points, or the largest double value if the window holds fewer than two points.
+ * @pre None.
+ * @post None.
+ */
+double SlidingWindowClosestPair::getClosestPair(long long &firstIndex, long long &secondIndex) const
+{
+    PointPair pair = this->pairs.getClosestPair();
+    if (this->window.size() < 2 || pair.getFirstIndex() < 0)
+    {
+        firstIndex = -1;
+        secondIndex = -1;
+        return numeric_limits<double>::max();
+    }
+
+    firstIndex = this->streamIndices[pair.getFirstIndex()];
+    secondIndex = this->streamIndices[pair.getSecondIndex()];
+    return pair.getDistance();
+}
+
+/*
+ * @brief Get the number of points in the window.
+ * @return The number of points.
+ * @pre None.
+ * @post None.
+ */
+size_t SlidingWindowClosestPair::size() const
+{
+    return this->window.size();
+}
+
+/*
+ * @brief Remove every point that is too old for the window.
+ * @param timestamp The latest time.
+ * @pre None.
+ * @post Every remaining point has a timestamp greater than timestamp - W.
+ */
+void SlidingWindowClosestPair::expirePoints(double timestamp)
+{
+    // Timestamps are non-decreasing along the queue, so the expired points are a prefix of it
+    while (!this->window.empty() && this->window.front().timestamp <= timestamp - this->windowLength)
+    {
+        this->pairs.deletePoint(this->window.front().id);
+        this->window.pop_front();
+    }
+}
+
+/*
+ * @brief Rebuild the dynamic structure from the points of the window.
+ * @pre None.
+ * @post The structure holds only the points of the window, with identifiers equal to their positions in the queue.
+ */
+void SlidingWindowClosestPair::compact()
+{
+    vector<double> xs(this->window.size()), ys(this->window.size());
+    this->streamIndices.assign(this->window.size(), 0);
+    for (size_t i = 0; i < this->window.size(); i++)
+    {
+        xs[i] = this->window[i].x;
+        ys[i] = this->window[i].y;
+        this->streamIndices[i] = this->window[i].streamIndex;
+        this->window[i].id = static_cast<int>(i);
+    }
+    this->pairs = DynamicClosestPair(PointSpan(xs.data(), ys.data(), xs.size()));
+}
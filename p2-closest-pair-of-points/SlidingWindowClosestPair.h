@@ -0,0 +1,114 @@
+/*
+ * @file SlidingWindowClosestPair.h
+ * @brief Declaration of the SlidingWindowClosestPair class for the closest pair of a timestamped point stream.
+ *
+ * This file contains the declaration of the SlidingWindowClosestPair class, which reports the closest pair
+ * among the points of a stream that arrived within the last W time units. Points must arrive in order of
+ * their timestamps. The points of the window are kept in a DynamicClosestPair, and a queue in arrival order
+ * tells which points expire as time advances, so each arrival and each expiry is a single update of the
+ * dynamic structure instead of a recomputation over the whole window.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "DynamicClosestPair.h"
+#include "Point.h"
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+/*
+ * @brief Class representing the closest pair of the points that arrived within a sliding time window.
+ */
+class SlidingWindowClosestPair
+{
+public:
+    /*
+     * @brief Constructor for SlidingWindowClosestPair class.
+     * @param windowLength The length W of the window, in the same unit as the timestamps.
+     * @pre windowLength > 0.
+     * @post An empty window is created; a point stays in it while its timestamp is greater than the latest time minus W.
+     */
+    explicit SlidingWindowClosestPair(double windowLength);
+
+    /*
+     * @brief Destructor for SlidingWindowClosestPair class.
+     * @pre None.
+     * @post The SlidingWindowClosestPair object and its associated resources are deallocated.
+     */
+    ~SlidingWindowClosestPair();
+
+    /*
+     * @brief Add the next point of the stream.
+     * @param point The point; its index is ignored.
+     * @param timestamp The arrival time of the point.
+     * @return The position of the point in the stream, counting from 0, or -1 if the timestamp is earlier than the latest time.
+     * @pre None.
+     * @post The window is advanced to the timestamp, and then holds the point.
+     */
+    long long addPoint(const Point &point, double timestamp);
+
+    /*
+     * @brief Advance the window without adding a point.
+     * @param timestamp The new latest time.
+     * @return True if the window was advanced, false if the timestamp is earlier than the latest time.
+     * @pre None.
+     * @post Every point with a timestamp of at most timestamp - W has left the window.
+     */
+    bool advanceTime(double timestamp);
+
+    /*
+     * @brief Get the closest pair of the points in the window.
+     * @param firstIndex Receives the stream position of the first point of the pair, or -1 if there is no pair.
+     * @param secondIndex Receives the stream position of the second point of the pair, or -1 if there is no pair.
+     * @return The distance between the two points, or the largest double value if the window holds fewer than two points.
+     * @pre None.
+     * @post None.
+     */
+    double getClosestPair(long long &firstIndex, long long &secondIndex) const;
+
+    /*
+     * @brief Get the number of points in the window.
+     * @return The number of points.
+     * @pre None.
+     * @post None.
+     */
+    size_t size() const;
+
+private:
+    /*
+     * @brief A point of the window, in arrival order.
+     */
+    struct WindowEntry
+    {
+        double x;              // x-coordinate of the point.
+        double y;              // y-coordinate of the point.
+        double timestamp;      // Arrival time of the point.
+        long long streamIndex; // Position of the point in the stream.
+        int id;                // Identifier of the point in the dynamic structure.
+    };
+
+    /*
+     * @brief Remove every point that is too old for the window.
+     * @param timestamp The latest time.
+     * @pre None.
+     * @post Every remaining point has a timestamp greater than timestamp - W.
+     */
+    void expirePoints(double timestamp);
+
+    /*
+     * @brief Rebuild the dynamic structure from the points of the window.
+     * @pre None.
+     * @post The structure holds only the points of the window, with identifiers equal to their positions in the queue.
+     */
+    void compact();
+
+    double windowLength;                  // Length W of the window.
+    double latestTime;                    // Timestamp of the latest arrival or advance.
+    long long arrivals;                   // Number of points added so far.
+    std::deque<WindowEntry> window;       // Points of the window, oldest first.
+    std::vector<long long> streamIndices; // Stream position of each identifier of the dynamic structure.
+    DynamicClosestPair pairs;             // Closest pair structure over the points of the window.
+};
@@ -0,0 +1,212 @@
+/*
+ * @file SpaceFillingCurve.cpp
+ * @brief Implementation of the SpaceFillingCurve class for reordering points along a Morton curve.
+ *
+ * This file contains the implementation of the SpaceFillingCurve class. Both coordinates are scaled by the
+ * same factor over the bounding box so the curve treats the axes alike. The keys are sorted by a radix sort
+ * over 8-bit digits: for every digit, each worker counts the digits of its block, the counts are turned into
+ * per-worker output offsets, and each worker scatters its block. Digits that are equal for every key are skipped.
+ *
+ * @author Phat Tran
+ */
+
+#include "SpaceFillingCurve.h"
+#include "ParallelUtils.h"
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+using namespace std;
+
+// Bits per radix sort digit
+const int RADIX_BITS = 8;
+
+// Number of distinct digit values
+const int RADIX_SIZE = 1 << RADIX_BITS;
+
+// Each worker of the radix sort handles at least this many keys
+const size_t MIN_KEYS_PER_WORKER = 1 << 16;
+
+/*
+ * @brief Compute the Morton key of every point.
+ * @param points The points, such as a PointSet.
+ * @return For each point, its coordinates scaled to 32 bits over the bounding box, with the bits interleaved (x in the even bits).
+ * @pre None.
+ * @post The keys are returned in input order.
+ */
+vector<uint64_t> SpaceFillingCurve::computeMortonKeys(const PointSpan &points)
+{
+    size_t size = points.size();
+    vector<uint64_t> keys(size);
+    if (size == 0)
+    {
+        return keys;
+    }
+
+    // Scale both axes by the larger extent of the bounding box
+    double minX = points.getX(0), maxX = minX;
+    double minY = points.getY(0), maxY = minY;
+    for (size_t i = 1; i < size; i++)
+    {
+        minX = min(minX, points.getX(i));
+        maxX = max(maxX, points.getX(i));
+        minY = min(minY, points.getY(i));
+        maxY = max(maxY, points.getY(i));
+    }
+    double extent = max(maxX - minX, maxY - minY);
+    double scale = (extent > 0.0) ? 4294967295.0 / extent : 0.0;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        uint32_t cellX = static_cast<uint32_t>(min((points.getX(i) - minX) * scale, 4294967295.0));
+        uint32_t cellY = static_cast<uint32_t>(min((points.getY(i) - minY) * scale, 4294967295.0));
+        keys[i] = spreadBits(cellX) | (spreadBits(cellY) << 1);
+    }
+    return keys;
+}
+
+/*
+ * @brief Compute the order of the points along the Morton curve.
+ * @param points The points, such as a PointSet.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @return The input positions of the points, sorted by Morton key; points with equal keys stay in input order.
+ * @pre None.
+ * @post The Morton order is returned.
+ */
+vector<int> SpaceFillingCurve::computeMortonOrder(const PointSpan &points, int threadCount)
+{
+    return radixSort(computeMortonKeys(points), threadCount);
+}
+
+/*
+ * @brief Reorder the points along the Morton curve.
+ * @param points The points, such as a PointSet.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @return The points in Morton order, each with its index set to its position in the input.
+ * @pre None.
+ * @post The reordered points are returned; results on them map back through getIndex.
+ */
+PointSet SpaceFillingCurve::reorderPoints(const PointSpan &points, int threadCount)
+{
+    vector<int> order = computeMortonOrder(points, threadCount);
+    PointSet reorderedPoints;
+    for (int position : order)
+    {
+        reorderedPoints.addPoint(Point(points.getX(position), points.getY(position), position));
+    }
+    return reorderedPoints;
+}
+
+/*
+ * @brief Spread the bits of a 32-bit value into the even bits of a 64-bit value.
+ * @param value The value to spread.
+ * @return The value with a zero bit inserted above each of its bits.
+ * @pre None.
+ * @post None.
+ */
+uint64_t SpaceFillingCurve::spreadBits(uint32_t value)
+{
+    uint64_t bits = value;
+    bits = (bits | (bits << 16)) & 0x0000FFFF0000FFFFULL;
+    bits = (bits | (bits << 8)) & 0x00FF00FF00FF00FFULL;
+    bits = (bits | (bits << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    bits = (bits | (bits << 2)) & 0x3333333333333333ULL;
+    bits = (bits | (bits << 1)) & 0x5555555555555555ULL;
+    return bits;
+}
+
+/*
+ * @brief Stable least significant digit radix sort of positions by their keys.
+ * @param keys The key of every position.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @return The positions sorted by key, ties kept in increasing position.
+ * @pre None.
+ * @post The sorted positions are returned.
+ */
+vector<int> SpaceFillingCurve::radixSort(const vector<uint64_t> &keys, int threadCount)
+{
+    size_t size = keys.size();
+    vector<uint64_t> currentKeys(keys), nextKeys(size);
+    vector<int> currentOrder(size), nextOrder(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        currentOrder[i] = static_cast<int>(i);
+    }
+
+    int workerCount = ParallelUtils::resolveThreadCount(threadCount, (size + MIN_KEYS_PER_WORKER - 1) / MIN_KEYS_PER_WORKER);
+    vector<vector<size_t>> offsets(workerCount, vector<size_t>(RADIX_SIZE));
+
+    // Run one phase of a pass on every worker, each on its own block of keys
+    auto runWorkers = [workerCount, size](const function<void(int, size_t, size_t)> &phase)
+    {
+        vector<thread> workers;
+        for (int worker = 0; worker < workerCount; worker++)
+        {
+            size_t begin = size * worker / workerCount;
+            size_t end = size * (worker + 1) / workerCount;
+            workers.push_back(thread(phase, worker, begin, end));
+        }
+        for (thread &worker : workers)
+        {
+            worker.join();
+        }
+    };
+
+    for (int shift = 0; shift < 64; shift += RADIX_BITS)
+    {
+        // Count the digits of every block
+        runWorkers([&currentKeys, &offsets, shift](int worker, size_t begin, size_t end)
+                   {
+                       vector<size_t> &counts = offsets[worker];
+                       fill(counts.begin(), counts.end(), 0);
+                       for (size_t i = begin; i < end; i++)
+                       {
+                           counts[(currentKeys[i] >> shift) & (RADIX_SIZE - 1)]++;
+                       }
+                   });
+
+        // A digit shared by every key leaves the order unchanged
+        bool singleDigit = false;
+        for (int digit = 0; digit < RADIX_SIZE && !singleDigit; digit++)
+        {
+            size_t total = 0;
+            for (int worker = 0; worker < workerCount; worker++)
+            {
+                total += offsets[worker][digit];
+            }
+            singleDigit = (total == size);
+        }
+        if (singleDigit)
+        {
+            continue;
+        }
+
+        // Turn the counts into output offsets: by digit first, then by worker
+        size_t offset = 0;
+        for (int digit = 0; digit < RADIX_SIZE; digit++)
+        {
+            for (int worker = 0; worker < workerCount; worker++)
+            {
+                size_t count = offsets[worker][digit];
+                offsets[worker][digit] = offset;
+                offset += count;
+            }
+        }
+
+        // Scatter every block to its offsets, keeping the order within each digit
+        runWorkers([&currentKeys, &currentOrder, &nextKeys, &nextOrder, &offsets, shift](int worker, size_t begin, size_t end)
+                   {
+                       vector<size_t> &positions = offsets[worker];
+                       for (size_t i = begin; i < end; i++)
+                       {
+                           size_t target = positions[(currentKeys[i] >> shift) & (RADIX_SIZE - 1)]++;
+                           nextKeys[target] = currentKeys[i];
+                           nextOrder[target] = currentOrder[i];
+                       }
+                   });
+        currentKeys.swap(nextKeys);
+        currentOrder.swap(nextOrder);
+    }
+
+    return currentOrder;
+}
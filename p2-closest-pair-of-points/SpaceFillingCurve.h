@@ -0,0 +1,74 @@
+/*
+ * @file SpaceFillingCurve.h
+ * @brief Declaration of the SpaceFillingCurve class for reordering points along a Morton curve.
+ *
+ * This file contains the declaration of the SpaceFillingCurve class, which computes the Morton (Z-order)
+ * key of every point of a PointSet and sorts the points by it with a parallel radix sort. Points that are
+ * close in the plane end up close in memory, so engines that walk a reordered PointSet touch memory almost
+ * sequentially. Each reordered point keeps the position it had in the original PointSet as its index.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include "PointSpan.h"
+#include <cstdint>
+#include <vector>
+
+/*
+ * @brief Class providing Morton curve keys and reordering for sets of points.
+ */
+class SpaceFillingCurve
+{
+public:
+    /*
+     * @brief Compute the Morton key of every point.
+     * @param points The points, such as a PointSet.
+     * @return For each point, its coordinates scaled to 32 bits over the bounding box, with the bits interleaved (x in the even bits).
+     * @pre None.
+     * @post The keys are returned in input order.
+     */
+    static std::vector<std::uint64_t> computeMortonKeys(const PointSpan &points);
+
+    /*
+     * @brief Compute the order of the points along the Morton curve.
+     * @param points The points, such as a PointSet.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @return The input positions of the points, sorted by Morton key; points with equal keys stay in input order.
+     * @pre None.
+     * @post The Morton order is returned.
+     */
+    static std::vector<int> computeMortonOrder(const PointSpan &points, int threadCount = 0);
+
+    /*
+     * @brief Reorder the points along the Morton curve.
+     * @param points The points, such as a PointSet.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @return The points in Morton order, each with its index set to its position in the input.
+     * @pre None.
+     * @post The reordered points are returned; results on them map back through getIndex.
+     */
+    static PointSet reorderPoints(const PointSpan &points, int threadCount = 0);
+
+    /*
+     * @brief Stable least significant digit radix sort of positions by their keys.
+     * @param keys The key of every position.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @return The positions sorted by key, ties kept in increasing position.
+     * @pre None.
+     * @post The sorted positions are returned.
+     */
+    static std::vector<int> radixSort(const std::vector<std::uint64_t> &keys, int threadCount = 0);
+
+private:
+    /*
+     * @brief Spread the bits of a 32-bit value into the even bits of a 64-bit value.
+     * @param value The value to spread.
+     * @return The value with a zero bit inserted above each of its bits.
+     * @pre None.
+     * @post None.
+     */
+    static std::uint64_t spreadBits(std::uint32_t value);
+};
@@ -0,0 +1,291 @@
+/*
+ * @file SpatialIndex.cpp
+ * @brief Implementation of the SpatialIndex class, a persistent presorted index for repeated queries.
+ *
+ * This file contains the implementation of the SpatialIndex class. Building the index runs its two
+ * independent parts, the x-order and the KdTree, as separate tasks spread over the worker threads. A query
+ * gathers the points along the stored order, dropping unselected ones, which keeps it sorted in O(n) time,
+ * and hands them to the presorted entry point of ClosestPairAlgorithm.
+ *
+ * @author Phat Tran
+ */
+
+#include "SpatialIndex.h"
+#include "ClosestPairAlgorithm.h"
+#include "ParallelUtils.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <thread>
+
+using namespace std;
+
+// Identifies an index file and its layout version
+const char INDEX_MAGIC[8] = {'C', 'P', 'I', 'N', 'D', 'E', 'X', '2'};
+
+/*
+ * @brief Default constructor for SpatialIndex class.
+ * @pre None.
+ * @post An empty SpatialIndex object is created, ready to be loaded from a file.
+ */
+SpatialIndex::SpatialIndex() : tree(vector<double>(), vector<double>()) {}
+
+/*
+ * @brief Constructor for SpatialIndex class.
+ * @param points The points to index, such as a PointSet; point i is reported with index i.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @pre None.
+ * @post The x-order and the KdTree are built, in parallel when threads are available.
+ */
+SpatialIndex::SpatialIndex(const PointSpan &points, int threadCount) : tree(vector<double>(), vector<double>())
+{
+    size_t size = points.size();
+    this->xs.resize(size);
+    this->ys.resize(size);
+    this->orderX.resize(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        this->xs[i] = points.getX(i);
+        this->ys[i] = points.getY(i);
+        this->orderX[i] = static_cast<int>(i);
+    }
+
+    // The order and the tree do not depend on each other
+    const vector<double> &pointXs = this->xs;
+    const vector<double> &pointYs = this->ys;
+    vector<function<void()>> tasks;
+    tasks.push_back([this, &pointXs, &pointYs]()
+                    { sort(this->orderX.begin(), this->orderX.end(), [&pointXs, &pointYs](int a, int b)
+                           {
+                               if (pointXs[a] != pointXs[b])
+                               {
+                                   return pointXs[a] < pointXs[b];
+                               }
+                               return (pointYs[a] != pointYs[b]) ? pointYs[a] < pointYs[b] : a < b;
+                           }); });
+    tasks.push_back([this, &pointXs, &pointYs]()
+                    { this->tree = KdTree(pointXs, pointYs); });
+
+    // Each worker runs every task whose position matches its number
+    int workerCount = ParallelUtils::resolveThreadCount(threadCount, tasks.size());
+    vector<thread> workers;
+    for (int worker = 0; worker < workerCount; worker++)
+    {
+        workers.push_back(thread([&tasks, worker, workerCount]()
+                                 {
+                                     for (size_t task = worker; task < tasks.size(); task += workerCount)
+                                     {
+                                         tasks[task]();
+                                     }
+                                 }));
+    }
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/*
+ * @brief Destructor for SpatialIndex class.
+ * @pre None.
+ * @post The SpatialIndex object and its associated resources are deallocated.
+ */
+SpatialIndex::~SpatialIndex() {}
+
+/*
+ * @brief Save the index to a binary file.
+ * @param path The path of the file to write.
+ * @return True if the file was written, false otherwise.
+ * @pre None.
+ * @post The file holds the index in the layout described above.
+ */
+bool SpatialIndex::save(const string &path) const
+{
+    ofstream file(path, ios::binary);
+    if (!file)
+    {
+        cerr << "Error: Could not open " << path << " for writing." << endl;
+        return false;
+    }
+
+    // Lay the tree out in its storage order so that loading does not rebuild it
+    size_t size = this->xs.size();
+    vector<double> treeXs(size), treeYs(size);
+    vector<int32_t> treeIds(size);
+    for (size_t position = 0; position < size; position++)
+    {
+        treeXs[position] = this->tree.getX(position);
+        treeYs[position] = this->tree.getY(position);
+        treeIds[position] = this->tree.getIndex(position);
+    }
+    vector<int32_t> orderXs(this->orderX.begin(), this->orderX.end());
+
+    // Header, then the 8-byte arrays, then the 4-byte arrays
+    uint64_t count = size;
+    file.write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char *>(this->xs.data()), size * sizeof(double));
+    file.write(reinterpret_cast<const char *>(this->ys.data()), size * sizeof(double));
+    file.write(reinterpret_cast<const char *>(treeXs.data()), size * sizeof(double));
+    file.write(reinterpret_cast<const char *>(treeYs.data()), size * sizeof(double));
+    file.write(reinterpret_cast<const char *>(orderXs.data()), size * sizeof(int32_t));
+    file.write(reinterpret_cast<const char *>(treeIds.data()), size * sizeof(int32_t));
+
+    if (!file)
+    {
+        cerr << "Error: Could not write the index to " << path << "." << endl;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * @brief Load an index from a binary file written by save.
+ * @param path The path of the file to read.
+ * @return True if the index was loaded, false otherwise (the index is then left unchanged).
+ * @pre None.
+ * @post The index holds the saved points, order and KdTree.
+ */
+bool SpatialIndex::load(const string &path)
+{
+    ifstream file(path, ios::binary);
+    if (!file)
+    {
+        cerr << "Error: Could not open " << path << " for reading." << endl;
+        return false;
+    }
+
+    // Check the header before trusting the point count
+    char magic[sizeof(INDEX_MAGIC)];
+    uint64_t count = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&count), sizeof(count));
+    if (!file || memcmp(magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 ||
+        count > static_cast<uint64_t>(numeric_limits<int32_t>::max()))
+    {
+        cerr << "Error: " << path << " is not a valid index file." << endl;
+        return false;
+    }
+
+    // Check the file is long enough to hold the arrays before allocating them
+    const uint64_t BYTES_PER_POINT = 4 * sizeof(double) + 2 * sizeof(int32_t);
+    streampos dataStart = file.tellg();
+    file.seekg(0, ios::end);
+    streampos dataEnd = file.tellg();
+    file.seekg(dataStart);
+    if (!file || static_cast<uint64_t>(dataEnd - dataStart) < count * BYTES_PER_POINT)
+    {
+        cerr << "Error: " << path << " is truncated." << endl;
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(count);
+    vector<double> pointXs(size), pointYs(size), treeXs(size), treeYs(size);
+    vector<int32_t> orderXs(size), treeIds(size);
+    file.read(reinterpret_cast<char *>(pointXs.data()), size * sizeof(double));
+    file.read(reinterpret_cast<char *>(pointYs.data()), size * sizeof(double));
+    file.read(reinterpret_cast<char *>(treeXs.data()), size * sizeof(double));
+    file.read(reinterpret_cast<char *>(treeYs.data()), size * sizeof(double));
+    file.read(reinterpret_cast<char *>(orderXs.data()), size * sizeof(int32_t));
+    file.read(reinterpret_cast<char *>(treeIds.data()), size * sizeof(int32_t));
+    if (!file)
+    {
+        cerr << "Error: " << path << " is truncated." << endl;
+        return false;
+    }
+
+    // Every stored index must refer to a point
+    for (size_t i = 0; i < size; i++)
+    {
+        if (orderXs[i] < 0 || orderXs[i] >= static_cast<int32_t>(size) ||
+            treeIds[i] < 0 || treeIds[i] >= static_cast<int32_t>(size))
+        {
+            cerr << "Error: " << path << " holds an index out of range." << endl;
+            return false;
+        }
+    }
+
+    this->xs.swap(pointXs);
+    this->ys.swap(pointYs);
+    this->orderX.assign(orderXs.begin(), orderXs.end());
+    this->tree = KdTree(treeXs, treeYs, vector<int>(treeIds.begin(), treeIds.end()));
+    return true;
+}
+
+/*
+ * @brief Find the closest pair of the indexed points without sorting them again.
+ * @return The closest pair, identified by the indices of its points, or an empty pair if there are fewer than two points.
+ * @pre None.
+ * @post The closest pair is returned.
+ */
+PointPair SpatialIndex::findClosestPair() const
+{
+    PointSet sortedPointsX;
+    gatherSortedPoints(nullptr, sortedPointsX);
+    return ClosestPairAlgorithm::findClosestPairPresorted(sortedPointsX);
+}
+
+/*
+ * @brief Find the closest pair among a subset of the indexed points without sorting them again.
+ * @param selected For every indexed point, whether it belongs to the subset.
+ * @return The closest pair of the subset, identified by the indices of its points, or an empty pair if fewer than two points are selected.
+ * @pre selected has one entry per indexed point.
+ * @post The closest pair of the subset is returned.
+ */
+PointPair SpatialIndex::findClosestPair(const vector<bool> &selected) const
+{
+    if (selected.size() != this->xs.size())
+    {
+        cerr << "Error: The subset selection must have one entry per indexed point." << endl;
+        return PointPair();
+    }
+
+    PointSet sortedPointsX;
+    gatherSortedPoints(&selected, sortedPointsX);
+    return ClosestPairAlgorithm::findClosestPairPresorted(sortedPointsX);
+}
+
+/*
+ * @brief Get the KdTree over the indexed points.
+ * @return The KdTree, which reports points by their indices.
+ * @pre None.
+ * @post The KdTree is returned.
+ */
+const KdTree &SpatialIndex::getTree() const
+{
+    return this->tree;
+}
+
+/*
+ * @brief Get the number of indexed points.
+ * @return The number of points.
+ * @pre None.
+ * @post The number of points is returned.
+ */
+size_t SpatialIndex::size() const
+{
+    return this->xs.size();
+}
+
+/*
+ * @brief Gather the indexed points in x-order, keeping only the selected ones.
+ * @param selected For every indexed point, whether to keep it, or nullptr to keep every point.
+ * @param sortedPointsX Receives the kept points in x-order, each tagged with its index.
+ * @pre selected is nullptr or has one entry per indexed point.
+ * @post The PointSet holds the kept points in the stored order.
+ */
+void SpatialIndex::gatherSortedPoints(const vector<bool> *selected, PointSet &sortedPointsX) const
+{
+    // Filtering a sorted order keeps it sorted
+    for (int index : this->orderX)
+    {
+        if (selected == nullptr || (*selected)[index])
+        {
+            sortedPointsX.addPoint(Point(this->xs[index], this->ys[index], index));
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * @file SpatialIndex.h
+ * @brief Declaration of the SpatialIndex class, a persistent presorted index for repeated queries.
+ *
+ * This file contains the declaration of the SpatialIndex class, which holds the order of a fixed dataset
+ * by x-coordinate together with a KdTree over it. The index is built once, in parallel, and can be
+ * saved to and loaded from a flat binary file. Closest pair queries against the index skip the presorting
+ * step, and queries on a subset of the points filter the stored order instead of sorting again.
+ *
+ * The file holds, in native byte order: the 8-byte magic "CPINDEX2", the point count n as a 64-bit integer,
+ * the double arrays xs, ys, treeXs and treeYs, then the 32-bit integer arrays orderX and treeIds, each of
+ * length n. Every array is naturally aligned, so the file can also be memory-mapped directly.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "PointSet.h"
+#include "PointSpan.h"
+#include "PointPair.h"
+#include "KdTree.h"
+#include <string>
+#include <vector>
+
+/*
+ * @brief Class representing a presorted index over a fixed set of points.
+ */
+class SpatialIndex
+{
+public:
+    /*
+     * @brief Default constructor for SpatialIndex class.
+     * @pre None.
+     * @post An empty SpatialIndex object is created, ready to be loaded from a file.
+     */
+    SpatialIndex();
+
+    /*
+     * @brief Constructor for SpatialIndex class.
+     * @param points The points to index, such as a PointSet; point i is reported with index i.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @pre None.
+     * @post The x-order and the KdTree are built, in parallel when threads are available.
+     */
+    explicit SpatialIndex(const PointSpan &points, int threadCount = 0);
+
+    /*
+     * @brief Destructor for SpatialIndex class.
+     * @pre None.
+     * @post The SpatialIndex object and its associated resources are deallocated.
+     */
+    ~SpatialIndex();
+
+    /*
+     * @brief Save the index to a binary file.
+     * @param path The path of the file to write.
+     * @return True if the file was written, false otherwise.
+     * @pre None.
+     * @post The file holds the index in the layout described above.
+     */
+    bool save(const std::string &path) const;
+
+    /*
+     * @brief Load an index from a binary file written by save.
+     * @param path The path of the file to read.
+     * @return True if the index was loaded, false otherwise (the index is then left unchanged).
+     * @pre None.
+     * @post The index holds the saved points, order and KdTree.
+     */
+    bool load(const std::string &path);
+
+    /*
+     * @brief Find the closest pair of the indexed points without sorting them again.
+     * @return The closest pair, identified by the indices of its points, or an empty pair if there are fewer than two points.
+     * @pre None.
+     * @post The closest pair is returned.
+     */
+    PointPair findClosestPair() const;
+
+    /*
+     * @brief Find the closest pair among a subset of the indexed points without sorting them again.
+     * @param selected For every indexed point, whether it belongs to the subset.
+     * @return The closest pair of the subset, identified by the indices of its points, or an empty pair if fewer than two points are selected.
+     * @pre selected has one entry per indexed point.
+     * @post The closest pair of the subset is returned.
+     */
+    PointPair findClosestPair(const std::vector<bool> &selected) const;
+
+    /*
+     * @brief Get the KdTree over the indexed points.
+     * @return The KdTree, which reports points by their indices.
+     * @pre None.
+     * @post The KdTree is returned.
+     */
+    const KdTree &getTree() const;
+
+    /*
+     * @brief Get the number of indexed points.
+     * @return The number of points.
+     * @pre None.
+     * @post The number of points is returned.
+     */
+    size_t size() const;
+
+private:
+    /*
+     * @brief Gather the indexed points in x-order, keeping only the selected ones.
+     * @param selected For every indexed point, whether to keep it, or nullptr to keep every point.
+     * @param sortedPointsX Receives the kept points in x-order, each tagged with its index.
+     * @pre selected is nullptr or has one entry per indexed point.
+     * @post The PointSet holds the kept points in the stored order.
+     */
+    void gatherSortedPoints(const std::vector<bool> *selected, PointSet &sortedPointsX) const;
+
+    std::vector<double> xs;  // x-coordinates in input order.
+    std::vector<double> ys;  // y-coordinates in input order.
+    std::vector<int> orderX; // Input indices sorted by x-coordinate, ties broken by y-coordinate, then index.
+    KdTree tree;             // KdTree over the points.
+};
@@ -0,0 +1,260 @@
+/*
+ * @file Benchmark.cpp
+ * @brief Implementation of the benchmark program for the closest pair engines.
+ *
+ * This file contains a benchmark program that times every closest pair engine on every distribution of
+ * PointGenerator, from 10,000 up to 10,000,000 points, and prints the results as JSON. Each run happens in
+ * a child process of its own, so that the peak resident memory reported by getrusage belongs to that run
+ * alone. A child generates its input, records the memory it holds, then runs the engine. Runs on up to
+ * 100,000 points are repeated and the fastest one is reported. To benchmark a new engine, add it to the
+ * list in createEngines.
+ *
+ * @author Phat Tran
+ */
+
+#include "PointGenerator.h"
+#include "../ClosestPairAlgorithm.h"
+#include "../DelaunayTriangulation.h"
+#include "../GenericClosestPairAlgorithm.h"
+#include "../SpatialIndex.h"
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Input sizes, each benchmarked unless it exceeds the requested maximum
+const size_t SIZES[] = {10000, 100000, 1000000, 10000000};
+
+// Runs on at most this many points are repeated to filter out noise
+const size_t REPEAT_LIMIT = 100000;
+const int REPEAT_ROUNDS = 5;
+
+/*
+ * @brief A closest pair engine under test.
+ */
+struct Engine
+{
+    string name;                            // Name in the report.
+    size_t maxPoints;                       // Largest input the engine is run on.
+    function<double(const PointSet &)> run; // Runs the engine and returns the distance it found.
+};
+
+/*
+ * @brief The measurements of one run.
+ */
+struct RunResult
+{
+    bool succeeded;      // Whether the child process reported back.
+    double seconds;      // Fastest time of the engine, without generating the input.
+    double distance;     // Distance found by the engine.
+    long peakKilobytes;  // Peak resident memory of the run.
+    long inputKilobytes; // Resident memory once the input was generated.
+};
+
+/*
+ * @brief List the engines to benchmark.
+ * @return The engines, each with the largest input it is run on.
+ * @pre None.
+ * @post None.
+ */
+vector<Engine> createEngines()
+{
+    vector<Engine> engines;
+    engines.push_back({"divide_and_conquer_traced", 10000000, [](const PointSet &points)
+                       {
+                           // The per-call trace goes to cout, which is silenced in the child
+                           return ClosestPairAlgorithm::findClosestPairDistance(points);
+                       }});
+    engines.push_back({"divide_and_conquer", 10000000, [](const PointSet &points)
+                       { return ClosestPairAlgorithm::findClosestPair(points).getDistance(); }});
+    engines.push_back({"approximate_0.1", 10000000, [](const PointSet &points)
+                       {
+                           double lowerBound;
+                           return ClosestPairAlgorithm::findApproximateClosestPairDistance(points, 0.1, lowerBound);
+                       }});
+    engines.push_back({"generic", 10000000, [](const PointSet &points)
+                       {
+                           vector<GenericPoint<double, 2>> genericPoints;
+                           genericPoints.reserve(points.size());
+                           for (size_t i = 0; i < points.size(); i++)
+                           {
+                               genericPoints.push_back(GenericPoint<double, 2>({points[i].getX(), points[i].getY()}));
+                           }
+                           return GenericClosestPairAlgorithm<double, 2>::findClosestPair(genericPoints).getDistance();
+                       }});
+    engines.push_back({"spatial_index", 10000000, [](const PointSet &points)
+                       { return SpatialIndex(points).findClosestPair().getDistance(); }});
+    engines.push_back({"delaunay", 1000000, [](const PointSet &points)
+                       { return DelaunayTriangulation(points).findClosestPair().getDistance(); }});
+    return engines;
+}
+
+/*
+ * @brief Get the peak resident memory of this process.
+ * @return The peak resident set size in kilobytes.
+ * @pre None.
+ * @post None.
+ */
+long getPeakKilobytes()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/*
+ * @brief Run an engine on a generated input in a child process.
+ * @param engine The engine to run.
+ * @param distribution The distribution of the input.
+ * @param count The number of points.
+ * @param seed The seed of the input.
+ * @return The measurements, with succeeded false if the child failed to report them.
+ * @pre None.
+ * @post The child process has exited.
+ */
+RunResult runIsolated(const Engine &engine, PointGenerator::Distribution distribution, size_t count, uint64_t seed)
+{
+    RunResult result = {false, 0.0, 0.0, 0, 0};
+    int channel[2];
+    if (pipe(channel) != 0)
+    {
+        cerr << "Error: Could not create a pipe to the benchmark process." << endl;
+        return result;
+    }
+
+    cout.flush();
+    pid_t child = fork();
+    if (child == 0)
+    {
+        close(channel[0]);
+        PointSet points = PointGenerator::generate(distribution, count, seed);
+        result.inputKilobytes = getPeakKilobytes();
+
+        // Keep the fastest round; the output of the traced engine is discarded
+        cout.setstate(ios::badbit);
+        result.seconds = numeric_limits<double>::max();
+        int rounds = (count <= REPEAT_LIMIT) ? REPEAT_ROUNDS : 1;
+        for (int round = 0; round < rounds; round++)
+        {
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            result.distance = engine.run(points);
+            result.seconds = min(result.seconds, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+        }
+        result.peakKilobytes = getPeakKilobytes();
+        result.succeeded = true;
+
+        ssize_t written = write(channel[1], &result, sizeof(result));
+        _exit(written == static_cast<ssize_t>(sizeof(result)) ? 0 : 1);
+    }
+
+    close(channel[1]);
+    if (child > 0)
+    {
+        // A child that crashes or runs out of memory closes the pipe without writing
+        if (read(channel[0], &result, sizeof(result)) != static_cast<ssize_t>(sizeof(result)))
+        {
+            result.succeeded = false;
+        }
+        waitpid(child, nullptr, 0);
+    }
+    else
+    {
+        cerr << "Error: Could not start the benchmark process." << endl;
+    }
+    close(channel[0]);
+    return result;
+}
+
+/*
+ * @brief Print one run as a JSON object.
+ * @param distribution The distribution of the input.
+ * @param count The number of points.
+ * @param engine The engine that was run.
+ * @param result The measurements.
+ * @pre None.
+ * @post The object is printed on one line, without a trailing comma.
+ */
+void printResult(PointGenerator::Distribution distribution, size_t count, const Engine &engine, const RunResult &result)
+{
+    cout << "    {\"distribution\": \"" << PointGenerator::getName(distribution) << "\", \"points\": " << count
+         << ", \"engine\": \"" << engine.name << "\"";
+    if (!result.succeeded)
+    {
+        cout << ", \"error\": \"the run did not finish\"}";
+        return;
+    }
+    double throughput = (result.seconds > 0.0) ? count / result.seconds : 0.0;
+    cout << ", \"seconds\": " << result.seconds << ", \"points_per_second\": " << throughput
+         << ", \"peak_rss_kb\": " << result.peakKilobytes << ", \"input_rss_kb\": " << result.inputKilobytes
+         << ", \"distance\": " << result.distance << "}";
+}
+
+/*
+ * @brief Main function for executing the closest pair benchmark.
+ * @param argc The number of command-line arguments.
+ * @param argv The arguments: optionally the largest input size (10,000,000 by default), then the seed (42 by default).
+ * @return 0 on success, 1 on invalid arguments.
+ * @pre None.
+ * @post The benchmark results are printed to standard output as JSON.
+ * @usage Benchmark [maxPoints [seed]]
+ */
+int main(int argc, char *argv[])
+{
+    size_t maxPoints = 10000000;
+    uint64_t seed = 42;
+    char *end = nullptr;
+    if (argc > 1)
+    {
+        maxPoints = strtoull(argv[1], &end, 10);
+    }
+    if (argc > 2 && (end == nullptr || *end == '\0'))
+    {
+        seed = strtoull(argv[2], &end, 10);
+    }
+    if (argc > 3 || (end != nullptr && *end != '\0'))
+    {
+        cerr << "Usage: " << argv[0] << " [maxPoints [seed]]" << endl;
+        return 1;
+    }
+
+    // Calibrate the leaf size once, so the forked runs inherit it instead of each timing it again
+    ClosestPairAlgorithm::calibrateLeafSize();
+
+    vector<Engine> engines = createEngines();
+    cout.precision(10);
+    cout << "{\n  \"seed\": " << seed << ",\n  \"results\": [";
+    bool first = true;
+    for (size_t count : SIZES)
+    {
+        if (count > maxPoints)
+        {
+            continue;
+        }
+        for (int distribution = 0; distribution < PointGenerator::DISTRIBUTION_COUNT; distribution++)
+        {
+            for (const Engine &engine : engines)
+            {
+                if (count > engine.maxPoints)
+                {
+                    continue;
+                }
+                RunResult result = runIsolated(engine, static_cast<PointGenerator::Distribution>(distribution), count, seed);
+                cout << (first ? "\n" : ",\n");
+                printResult(static_cast<PointGenerator::Distribution>(distribution), count, engine, result);
+                cout.flush();
+                first = false;
+            }
+        }
+    }
+    cout << "\n  ]\n}" << endl;
+
+    return 0;
+}
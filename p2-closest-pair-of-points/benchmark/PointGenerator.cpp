@@ -0,0 +1,169 @@
+/*
+ * @file PointGenerator.cpp
+ * @brief Implementation of the PointGenerator class, seeded synthetic inputs for the closest pair benchmark.
+ *
+ * This file contains the implementation of the PointGenerator class. Every distribution draws from a
+ * 64-bit Mersenne Twister seeded with the given seed, and all coordinates lie in a square of side
+ * 1,000,000, except for the lattice, whose neighbors are exactly 1 apart.
+ *
+ * @author Phat Tran
+ */
+
+#include "PointGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// Side of the square that holds the points
+const double SIDE = 1000000.0;
+
+// Number of Gaussian blobs in the clustered distribution
+const int CLUSTER_COUNT = 16;
+
+// Standard deviation of each blob, as a fraction of the side
+const double CLUSTER_SPREAD = 0.001;
+
+// Number of distinct x-coordinates in the duplicate-x distribution
+const int COLUMN_COUNT = 100;
+
+// The duplicates distribution draws from a pool of one distinct point per this many points
+const size_t POINTS_PER_DISTINCT = 10;
+
+/*
+ * @brief Generate a point set.
+ * @param distribution The distribution to draw from.
+ * @param count The number of points.
+ * @param seed The seed of the pseudo-random generator.
+ * @return The generated points, with indices equal to their positions.
+ * @pre None.
+ * @post The same arguments always produce the same points.
+ */
+PointSet PointGenerator::generate(Distribution distribution, size_t count, uint64_t seed)
+{
+    mt19937_64 generator(seed);
+    uniform_real_distribution<double> coordinate(0.0, SIDE);
+    vector<double> xs(count), ys(count);
+
+    switch (distribution)
+    {
+    case UNIFORM:
+        for (size_t i = 0; i < count; i++)
+        {
+            xs[i] = coordinate(generator);
+            ys[i] = coordinate(generator);
+        }
+        break;
+
+    case CLUSTERED:
+    {
+        vector<double> centerXs(CLUSTER_COUNT), centerYs(CLUSTER_COUNT);
+        for (int cluster = 0; cluster < CLUSTER_COUNT; cluster++)
+        {
+            centerXs[cluster] = coordinate(generator);
+            centerYs[cluster] = coordinate(generator);
+        }
+        uniform_int_distribution<int> pickCluster(0, CLUSTER_COUNT - 1);
+        normal_distribution<double> offset(0.0, CLUSTER_SPREAD * SIDE);
+        for (size_t i = 0; i < count; i++)
+        {
+            int cluster = pickCluster(generator);
+            xs[i] = centerXs[cluster] + offset(generator);
+            ys[i] = centerYs[cluster] + offset(generator);
+        }
+        break;
+    }
+
+    case COLLINEAR:
+        for (size_t i = 0; i < count; i++)
+        {
+            xs[i] = coordinate(generator);
+            ys[i] = 0.5 * xs[i] + 1000.0;
+        }
+        break;
+
+    case DUPLICATE_X:
+    {
+        uniform_int_distribution<int> pickColumn(0, COLUMN_COUNT - 1);
+        for (size_t i = 0; i < count; i++)
+        {
+            xs[i] = pickColumn(generator) * (SIDE / COLUMN_COUNT);
+            ys[i] = coordinate(generator);
+        }
+        break;
+    }
+
+    case DUPLICATES:
+    {
+        size_t poolSize = max(count / POINTS_PER_DISTINCT, static_cast<size_t>(1));
+        vector<double> poolXs(poolSize), poolYs(poolSize);
+        for (size_t i = 0; i < poolSize; i++)
+        {
+            poolXs[i] = coordinate(generator);
+            poolYs[i] = coordinate(generator);
+        }
+        uniform_int_distribution<size_t> pickPoint(0, poolSize - 1);
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t point = pickPoint(generator);
+            xs[i] = poolXs[point];
+            ys[i] = poolYs[point];
+        }
+        break;
+    }
+
+    case LATTICE:
+    {
+        // Fill the grid row by row, then shuffle so the input order carries no hint
+        size_t side = static_cast<size_t>(ceil(sqrt(static_cast<double>(count))));
+        vector<size_t> cells(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            cells[i] = i;
+        }
+        shuffle(cells.begin(), cells.end(), generator);
+        for (size_t i = 0; i < count; i++)
+        {
+            xs[i] = static_cast<double>(cells[i] % side);
+            ys[i] = static_cast<double>(cells[i] / side);
+        }
+        break;
+    }
+    }
+
+    PointSet pointSet;
+    for (size_t i = 0; i < count; i++)
+    {
+        pointSet.addPoint(Point(xs[i], ys[i], static_cast<int>(i)));
+    }
+    return pointSet;
+}
+
+/*
+ * @brief Get the name of a distribution, as used in the benchmark report.
+ * @param distribution The distribution.
+ * @return The name in lower case with underscores.
+ * @pre None.
+ * @post None.
+ */
+string PointGenerator::getName(Distribution distribution)
+{
+    switch (distribution)
+    {
+    case UNIFORM:
+        return "uniform";
+    case CLUSTERED:
+        return "clustered";
+    case COLLINEAR:
+        return "collinear";
+    case DUPLICATE_X:
+        return "duplicate_x";
+    case DUPLICATES:
+        return "duplicates";
+    case LATTICE:
+        return "lattice";
+    }
+    return "unknown";
+}
@@ -0,0 +1,62 @@
+/*
+ * @file PointGenerator.h
+ * @brief Declaration of the PointGenerator class, seeded synthetic inputs for the closest pair benchmark.
+ *
+ * This file contains the declaration of the PointGenerator class, which produces reproducible point sets
+ * for benchmarking. Besides uniform points, it generates the inputs where a divide and conquer closest pair
+ * search works hardest: Gaussian clusters, points on one line, many points sharing an x-coordinate, exact
+ * duplicates, and an integer lattice where every point has several neighbors at the same distance. The same
+ * distribution, size and seed always give the same points.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "../PointSet.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+ * @brief Class providing seeded point set generators for benchmarks.
+ */
+class PointGenerator
+{
+public:
+    /*
+     * @brief The supported point distributions.
+     */
+    enum Distribution
+    {
+        UNIFORM,     // Independent uniform points in a square.
+        CLUSTERED,   // Gaussian blobs around uniform centers.
+        COLLINEAR,   // Uniform points on one diagonal line.
+        DUPLICATE_X, // Uniform y-coordinates on a small number of shared x-coordinates.
+        DUPLICATES,  // Points drawn with repetition from a pool a tenth of the size.
+        LATTICE      // A shuffled square integer grid.
+    };
+
+    // Number of distributions, for iterating over all of them.
+    static const int DISTRIBUTION_COUNT = 6;
+
+    /*
+     * @brief Generate a point set.
+     * @param distribution The distribution to draw from.
+     * @param count The number of points.
+     * @param seed The seed of the pseudo-random generator.
+     * @return The generated points, with indices equal to their positions.
+     * @pre None.
+     * @post The same arguments always produce the same points.
+     */
+    static PointSet generate(Distribution distribution, size_t count, std::uint64_t seed);
+
+    /*
+     * @brief Get the name of a distribution, as used in the benchmark report.
+     * @param distribution The distribution.
+     * @return The name in lower case with underscores.
+     * @pre None.
+     * @post None.
+     */
+    static std::string getName(Distribution distribution);
+};
@@ -0,0 +1,214 @@
+/*
+ * @file DynamicClosestPairTest.cpp
+ * @brief Randomized test of the DynamicClosestPair class against a brute-force search.
+ *
+ * This file contains a test program that applies seeded random inserts, deletes and moves to a
+ * DynamicClosestPair and checks the reported closest pair after every update against a brute-force search
+ * over the live points. The inputs cover random real coordinates, a small integer grid with many equal
+ * distances, and many copies of a few locations. It also checks that a structure built from two points
+ * reports their pair. The program prints every mismatch and exits with a non-zero status if any occurred.
+ *
+ * @author Phat Tran
+ */
+
+#include "../DynamicClosestPair.h"
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// Number of random update sequences per kind of input
+const int SEQUENCE_COUNT = 200;
+
+// Number of updates per sequence
+const int UPDATE_COUNT = 300;
+
+// Number of seeds for the two-point check
+const int PAIR_SEEDS = 100000;
+
+/*
+ * @brief The kinds of coordinates drawn by the test.
+ */
+enum Coordinates
+{
+    REAL,   // Uniform real coordinates.
+    GRID,   // Integer coordinates on a small grid.
+    COPIES  // A few fixed locations, each repeated many times.
+};
+
+/*
+ * @brief Draw a point of the given kind.
+ * @param kind The kind of coordinates.
+ * @param random The pseudo-random generator.
+ * @return The point.
+ * @pre None.
+ * @post None.
+ */
+Point drawPoint(Coordinates kind, mt19937_64 &random)
+{
+    if (kind == GRID)
+    {
+        return Point(static_cast<double>(random() % 12), static_cast<double>(random() % 12));
+    }
+    if (kind == COPIES)
+    {
+        int location = static_cast<int>(random() % 4);
+        return Point(location * 0.75, location * 1.5);
+    }
+    uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    return Point(coordinate(random), coordinate(random));
+}
+
+/*
+ * @brief Find the closest pair distance of the live points by comparing every pair.
+ * @param points The points by identifier.
+ * @param alive Whether each identifier is live.
+ * @return The closest pair distance, or the maximum double if fewer than two points are live.
+ * @pre None.
+ * @post None.
+ */
+double findBruteForceDistance(const vector<Point> &points, const vector<bool> &alive)
+{
+    double best = numeric_limits<double>::max();
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        for (size_t j = i + 1; alive[i] && j < points.size(); j++)
+        {
+            if (alive[j])
+            {
+                best = min(best, Point::calculateDistance(points[i], points[j]));
+            }
+        }
+    }
+    return best;
+}
+
+/*
+ * @brief Check the reported closest pair against the live points.
+ * @param structure The structure under test.
+ * @param points The points by identifier.
+ * @param alive Whether each identifier is live.
+ * @return True if the pair is live and at the brute-force distance, or absent with fewer than two live points.
+ * @pre None.
+ * @post None.
+ */
+bool checkClosestPair(const DynamicClosestPair &structure, const vector<Point> &points, const vector<bool> &alive)
+{
+    PointPair closest = structure.getClosestPair();
+    double expected = findBruteForceDistance(points, alive);
+    if (structure.size() < 2)
+    {
+        return expected == numeric_limits<double>::max();
+    }
+    int first = closest.getFirstIndex(), second = closest.getSecondIndex();
+    if (first < 0 || second < 0 || first == second || !alive[first] || !alive[second])
+    {
+        return false;
+    }
+    return closest.getDistance() == expected && Point::calculateDistance(points[first], points[second]) == expected;
+}
+
+/*
+ * @brief Apply one random sequence of updates and check the closest pair after each of them.
+ * @param kind The kind of coordinates.
+ * @param seed The seed of the sequence.
+ * @return The number of mismatches.
+ * @pre None.
+ * @post Every mismatch is printed.
+ */
+int runSequence(Coordinates kind, uint64_t seed)
+{
+    mt19937_64 random(seed);
+    vector<Point> points;
+    PointSet initial;
+    size_t initialCount = random() % 40;
+    for (size_t i = 0; i < initialCount; i++)
+    {
+        points.push_back(drawPoint(kind, random));
+        initial.addPoint(points.back());
+    }
+    vector<bool> alive(points.size(), true);
+    DynamicClosestPair structure(initial);
+
+    int failures = 0;
+    for (int update = 0; update < UPDATE_COUNT; update++)
+    {
+        int action = static_cast<int>(random() % 3);
+        if (action == 0 || points.empty())
+        {
+            points.push_back(drawPoint(kind, random));
+            alive.push_back(true);
+            structure.insertPoint(points.back());
+        }
+        else
+        {
+            // Half of the time, update a point of the current closest pair
+            int id = static_cast<int>(random() % points.size());
+            PointPair closest = structure.getClosestPair();
+            if (random() % 2 == 0 && closest.getFirstIndex() >= 0)
+            {
+                id = closest.getFirstIndex();
+            }
+            if (action == 1)
+            {
+                structure.deletePoint(id);
+                alive[id] = false;
+            }
+            else
+            {
+                Point moved = drawPoint(kind, random);
+                if (structure.movePoint(id, moved.getX(), moved.getY()))
+                {
+                    points[id] = moved;
+                }
+            }
+        }
+
+        if (!checkClosestPair(structure, points, alive))
+        {
+            cout << "Mismatch: coordinates " << kind << ", seed " << seed << ", update " << update << endl;
+            failures++;
+        }
+    }
+    return failures;
+}
+
+/*
+ * @brief Main function for executing the dynamic closest pair test.
+ * @return 0 if every check passed, 1 otherwise.
+ * @pre None.
+ * @post Every mismatch is printed, followed by a summary.
+ */
+int main()
+{
+    int failures = 0;
+
+    // A structure built from two points must report their pair
+    uniform_real_distribution<double> coordinate(0.0, 1.0);
+    for (int seed = 0; seed < PAIR_SEEDS; seed++)
+    {
+        mt19937_64 random(seed);
+        PointSet points;
+        points.addPoint(Point(coordinate(random), coordinate(random)));
+        points.addPoint(Point(coordinate(random), coordinate(random)));
+        if (DynamicClosestPair(points).getClosestPair().getFirstIndex() < 0)
+        {
+            failures++;
+        }
+    }
+
+    for (int kind = REAL; kind <= COPIES; kind++)
+    {
+        for (int seed = 0; seed < SEQUENCE_COUNT; seed++)
+        {
+            failures += runSequence(static_cast<Coordinates>(kind), seed);
+        }
+    }
+
+    cout << (failures == 0 ? "All dynamic closest pair checks passed." : "Dynamic closest pair checks failed: ")
+         << (failures == 0 ? "" : to_string(failures)) << endl;
+    return failures == 0 ? 0 : 1;
+}
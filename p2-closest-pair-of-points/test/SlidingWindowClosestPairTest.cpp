@@ -0,0 +1,159 @@
+/*
+ * @file SlidingWindowClosestPairTest.cpp
+ * @brief Randomized test of the SlidingWindowClosestPair class against a brute-force search over the window.
+ *
+ * This file contains a test program that feeds seeded random streams to a SlidingWindowClosestPair and
+ * checks the reported closest pair after every arrival and every advance of time against a brute-force
+ * search over the points whose timestamps are still inside the window. The streams mix real and grid
+ * coordinates, repeated timestamps and idle gaps, and run long enough for the structure to be compacted.
+ * The program prints every mismatch and exits with a non-zero status if any occurred.
+ *
+ * @author Phat Tran
+ */
+
+#include "../SlidingWindowClosestPair.h"
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Number of random streams
+const int STREAM_COUNT = 60;
+
+// Number of events per stream, enough to compact the structure several times
+const int EVENT_COUNT = 4000;
+
+// Length of the window, in timestamp units
+const double WINDOW_LENGTH = 30.0;
+
+/*
+ * @brief A point of the stream as remembered by the test.
+ */
+struct Arrival
+{
+    Point point;      // The point.
+    double timestamp; // Its arrival time.
+};
+
+/*
+ * @brief Check the reported closest pair against the points still in the window.
+ * @param window The structure under test.
+ * @param arrivals Every point of the stream, by stream position.
+ * @param latestTime The latest time of the stream.
+ * @return True if the pair is in the window and at the brute-force distance, or absent with fewer than two points.
+ * @pre None.
+ * @post None.
+ */
+bool checkWindow(const SlidingWindowClosestPair &window, const vector<Arrival> &arrivals, double latestTime)
+{
+    vector<size_t> inside;
+    for (size_t i = 0; i < arrivals.size(); i++)
+    {
+        if (arrivals[i].timestamp > latestTime - WINDOW_LENGTH)
+        {
+            inside.push_back(i);
+        }
+    }
+    double expected = numeric_limits<double>::max();
+    for (size_t i = 0; i < inside.size(); i++)
+    {
+        for (size_t j = i + 1; j < inside.size(); j++)
+        {
+            expected = min(expected, Point::calculateDistance(arrivals[inside[i]].point, arrivals[inside[j]].point));
+        }
+    }
+
+    long long first, second;
+    double distance = window.getClosestPair(first, second);
+    if (window.size() != inside.size())
+    {
+        return false;
+    }
+    if (inside.size() < 2)
+    {
+        return first == -1 && second == -1 && distance == numeric_limits<double>::max();
+    }
+    if (first < static_cast<long long>(inside.front()) || second < static_cast<long long>(inside.front()) ||
+        first >= static_cast<long long>(arrivals.size()) || second >= static_cast<long long>(arrivals.size()) || first == second)
+    {
+        return false;
+    }
+    return distance == expected && Point::calculateDistance(arrivals[first].point, arrivals[second].point) == expected;
+}
+
+/*
+ * @brief Feed one random stream to a window and check it after every event.
+ * @param seed The seed of the stream.
+ * @return The number of mismatches.
+ * @pre None.
+ * @post Every mismatch is printed.
+ */
+int runStream(uint64_t seed)
+{
+    mt19937_64 random(seed);
+    uniform_real_distribution<double> coordinate(0.0, 100.0);
+    bool grid = seed % 2 == 1;
+    SlidingWindowClosestPair window(WINDOW_LENGTH);
+    vector<Arrival> arrivals;
+    double time = 0.0;
+
+    int failures = 0;
+    for (int event = 0; event < EVENT_COUNT; event++)
+    {
+        // Timestamps repeat a third of the time, and occasionally jump past the whole window
+        int step = static_cast<int>(random() % 60);
+        if (step < 40)
+        {
+            time += (step < 20) ? 0.0 : 0.5;
+        }
+        else
+        {
+            time += (step == 59) ? 2.0 * WINDOW_LENGTH : 1.0;
+        }
+
+        if (random() % 10 == 0)
+        {
+            window.advanceTime(time);
+        }
+        else
+        {
+            Point point = grid ? Point(static_cast<double>(random() % 16), static_cast<double>(random() % 16))
+                               : Point(coordinate(random), coordinate(random));
+            if (window.addPoint(point, time) != static_cast<long long>(arrivals.size()))
+            {
+                failures++;
+            }
+            arrivals.push_back({point, time});
+        }
+
+        if (!checkWindow(window, arrivals, time))
+        {
+            cout << "Mismatch: seed " << seed << ", event " << event << endl;
+            failures++;
+        }
+    }
+    return failures;
+}
+
+/*
+ * @brief Main function for executing the sliding-window closest pair test.
+ * @return 0 if every check passed, 1 otherwise.
+ * @pre None.
+ * @post Every mismatch is printed, followed by a summary.
+ */
+int main()
+{
+    int failures = 0;
+    for (int seed = 0; seed < STREAM_COUNT; seed++)
+    {
+        failures += runStream(seed);
+    }
+
+    cout << (failures == 0 ? "All sliding-window closest pair checks passed." : "Sliding-window closest pair checks failed: ")
+         << (failures == 0 ? "" : to_string(failures)) << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/*
+ * @file DinicAlgorithm.cpp
+ * @brief Implementation of the DinicAlgorithm class functions.
+ *
+ * This file contains the implementation of the functions declared in the DinicAlgorithm class. The blocking flow
+ * search is an iterative depth-first search that keeps the arcs of the current path on an explicit stack, so long
+ * paths in graphs with millions of nodes cannot overflow the call stack. After an augmentation the search resumes
+ * from the tail of the first saturated arc instead of from the source.
+ *
+ * @author Phat Tran
+ */
+
+#include <algorithm>
+#include <limits>
+#include "DinicAlgorithm.h"
+#include "ParallelBFSAlgorithm.h"
+
+using namespace std;
+
+/*
+ * @brief Find a maximum flow from a source to a sink.
+ * @param network The residual network, which may already carry flow.
+ * @param source The index of the source node.
+ * @param sink The index of the sink node.
+ * @return The amount of flow added to the network.
+ * @pre The network is built, and source and sink are distinct nodes of it.
+ * @post The network carries a maximum flow from the source to the sink.
+ */
+long long DinicAlgorithm::findMaxFlow(ResidualNetwork &network, int source, int sink)
+{
+    int nodeCount = network.getNodeCount();
+    vector<int> levels(nodeCount), currentArcs(nodeCount), pathArcs;
+    long long totalFlow = 0;
+
+    // Each phase strictly increases the distance from the source to the sink
+    while (ParallelBFSAlgorithm::buildLevels(network, source, sink, levels))
+    {
+        for (int node = 0; node < nodeCount; node++)
+        {
+            currentArcs[node] = network.getArcBegin(node);
+        }
+        totalFlow += sendBlockingFlow(network, source, sink, levels, currentArcs, pathArcs);
+    }
+
+    return totalFlow;
+}
+
+/*
+ * @brief Send a blocking flow along the arcs that lead one level deeper.
+ * @param network The residual network.
+ * @param source The index of the source node.
+ * @param sink The index of the sink node.
+ * @param levels The distance of each node; nodes found to be dead ends are set to -1.
+ * @param currentArcs The next arc to try at each node, starting at the first arc of the node.
+ * @param pathArcs Scratch space for the arcs of the current path.
+ * @return The amount of flow sent.
+ * @pre levels comes from ParallelBFSAlgorithm::buildLevels on the current network.
+ * @post No path from the source to the sink remains in the level graph.
+ */
+long long DinicAlgorithm::sendBlockingFlow(ResidualNetwork &network, int source, int sink, vector<int> &levels,
+                                           vector<int> &currentArcs, vector<int> &pathArcs)
+{
+    long long blockingFlow = 0;
+    pathArcs.clear();
+    int node = source;
+
+    while (true)
+    {
+        if (node == sink)
+        {
+            // Augment by the bottleneck of the path
+            int bottleneck = numeric_limits<int>::max();
+            for (int arc : pathArcs)
+            {
+                bottleneck = min(bottleneck, network.getCapacity(arc));
+            }
+            size_t firstSaturated = pathArcs.size();
+            for (size_t i = 0; i < pathArcs.size(); i++)
+            {
+                network.pushFlow(pathArcs[i], bottleneck);
+                if (firstSaturated == pathArcs.size() && network.getCapacity(pathArcs[i]) == 0)
+                {
+                    firstSaturated = i;
+                }
+            }
+            blockingFlow += bottleneck;
+
+            // Resume from the tail of the first saturated arc; the arcs before it still have capacity
+            node = network.getHead(network.getReverseArc(pathArcs[firstSaturated]));
+            pathArcs.resize(firstSaturated);
+            continue;
+        }
+
+        // Advance along the current arc of the node, skipping arcs that are full or do not lead one level deeper
+        int &arc = currentArcs[node];
+        int arcEnd = network.getArcEnd(node);
+        while (arc < arcEnd && (network.getCapacity(arc) == 0 || levels[network.getHead(arc)] != levels[node] + 1))
+        {
+            arc++;
+        }
+
+        if (arc < arcEnd)
+        {
+            pathArcs.push_back(arc);
+            node = network.getHead(arc);
+        }
+        else
+        {
+            // Retreat: the node is a dead end for the rest of the phase
+            levels[node] = -1;
+            if (node == source)
+            {
+                break;
+            }
+            int lastArc = pathArcs.back();
+            pathArcs.pop_back();
+            node = network.getHead(network.getReverseArc(lastArc));
+            currentArcs[node]++;
+        }
+    }
+
+    return blockingFlow;
+}
@@ -0,0 +1,51 @@
+/*
+ * @file DinicAlgorithm.h
+ * @brief Declaration of the DinicAlgorithm class, Dinic's maximum flow algorithm on a residual network.
+ *
+ * This file defines the DinicAlgorithm class. Each phase labels the nodes with their BFS distance from the source,
+ * using the multithreaded search of ParallelBFSAlgorithm, then sends a blocking flow along arcs that lead exactly
+ * one level deeper. Every node keeps a current-arc pointer that only moves forward within a phase, and a node that
+ * cannot reach the sink is retired by clearing its level, so the level graph is never copied and no arc is ever
+ * deleted. On unit-capacity bipartite graphs this takes O(E sqrt(V)) time.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+#include "ResidualNetwork.h"
+
+/*
+ * @brief Class providing Dinic's maximum flow algorithm.
+ */
+class DinicAlgorithm
+{
+public:
+    /*
+     * @brief Find a maximum flow from a source to a sink.
+     * @param network The residual network, which may already carry flow.
+     * @param source The index of the source node.
+     * @param sink The index of the sink node.
+     * @return The amount of flow added to the network.
+     * @pre The network is built, and source and sink are distinct nodes of it.
+     * @post The network carries a maximum flow from the source to the sink.
+     */
+    static long long findMaxFlow(ResidualNetwork &network, int source, int sink);
+
+private:
+    /*
+     * @brief Send a blocking flow along the arcs that lead one level deeper.
+     * @param network The residual network.
+     * @param source The index of the source node.
+     * @param sink The index of the sink node.
+     * @param levels The distance of each node; nodes found to be dead ends are set to -1.
+     * @param currentArcs The next arc to try at each node, starting at the first arc of the node.
+     * @param pathArcs Scratch space for the arcs of the current path.
+     * @return The amount of flow sent.
+     * @pre levels comes from ParallelBFSAlgorithm::buildLevels on the current network.
+     * @post No path from the source to the sink remains in the level graph.
+     */
+    static long long sendBlockingFlow(ResidualNetwork &network, int source, int sink, std::vector<int> &levels,
+                                      std::vector<int> &currentArcs, std::vector<int> &pathArcs);
+};
@@ -3,7 +3,7 @@
  * @brief Implementation of the Edge class.
  *
  * This file contains the implementation of the functions declared in the Edge class.
- * It includes a constructor, a destructor, and getter/setter functions for the source, destination, and flow status of an edge.
+ * It includes a constructor, a destructor, and getter/setter functions for the source, destination, capacity, weight, and flow status of an edge.
  *
  * @author Phat Tran
  */
@@ -15,10 +15,13 @@
  * @param source The index of the source node.
  * @param destination The index of the destination node.
  * @param hasFlow Represents whether there is a flow on the edge.
+ * @param capacity The capacity of the edge, optional with a default of 1.
+ * @param weight The cost of one unit of flow on the edge, optional with a default of 0.
  * @pre None.
- * @post An Edge object is created with the specified source, destination, and flow status.
+ * @post An Edge object is created with the specified source, destination, flow status, capacity, and weight.
  */
-Edge::Edge(int source, int destination, bool hasFlow) : source(source), destination(destination), flow(hasFlow) {}
+Edge::Edge(int source, int destination, bool hasFlow, int capacity, int weight)
+    : source(source), destination(destination), flow(hasFlow), capacity(capacity), weight(weight) {}
 
 /*
  * @brief Destructor for Edge class.
@@ -49,6 +52,28 @@ int Edge::getDestinationIndex() const
     return this->destination;
 }
 
+/*
+ * @brief Get the capacity of the edge.
+ * @return The most flow the edge can carry.
+ * @pre The Edge object must exist.
+ * @post The capacity of the edge is returned.
+ */
+int Edge::getCapacity() const
+{
+    return this->capacity;
+}
+
+/*
+ * @brief Get the weight of the edge.
+ * @return The cost of one unit of flow on the edge.
+ * @pre The Edge object must exist.
+ * @post The weight of the edge is returned.
+ */
+int Edge::getWeight() const
+{
+    return this->weight;
+}
+
 /*
  * @brief Check whether there is a flow on the edge.
  * @return True if there is a flow on the edge, false otherwise.
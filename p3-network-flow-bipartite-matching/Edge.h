@@ -2,7 +2,7 @@
  * @file Edge.h
  * @brief Declaration of the Edge class, representing an edge in a graph.
  *
- * This file defines the Edge class, encapsulating the source and destination nodes in a graph and whether there is a flow on the edge.
+ * This file defines the Edge class, encapsulating the source and destination nodes in a graph, the capacity and weight of the edge, and whether there is a flow on it.
  * It includes a constructors, a destructor, and getter/setter functions for the source, destination, and flow status.
  *
  * @author Phat Tran
@@ -23,10 +23,12 @@ public:
      * @param source The index of the source node.
      * @param destination The index of the destination node.
      * @param hasFlow Represents whether there is a flow on the edge.
+     * @param capacity The capacity of the edge, optional with a default of 1.
+     * @param weight The cost of one unit of flow on the edge, optional with a default of 0.
      * @pre None.
-     * @post An Edge object is created with the specified source, destination, and flow status.
+     * @post An Edge object is created with the specified source, destination, flow status, capacity, and weight.
      */
-    Edge(int source, int destination, bool hasFlow);
+    Edge(int source, int destination, bool hasFlow, int capacity = 1, int weight = 0);
 
     /*
      * @brief Destructor for Edge class.
@@ -51,6 +53,22 @@ public:
      */
     int getDestinationIndex() const;
 
+    /*
+     * @brief Get the capacity of the edge.
+     * @return The most flow the edge can carry.
+     * @pre The Edge object must exist.
+     * @post The capacity of the edge is returned.
+     */
+    int getCapacity() const;
+
+    /*
+     * @brief Get the weight of the edge.
+     * @return The cost of one unit of flow on the edge.
+     * @pre The Edge object must exist.
+     * @post The weight of the edge is returned.
+     */
+    int getWeight() const;
+
     /*
      * @brief Check whether there is a flow on the edge.
      * @return True if there is a flow on the edge, false otherwise.
@@ -71,4 +89,6 @@ private:
     int source;      // Index of the source node.
     int destination; // Index of the destination node.
     bool flow;       // Represents whether there is a flow on the edge.
+    int capacity;    // Most flow the edge can carry.
+    int weight;      // Cost of one unit of flow on the edge.
 };
@@ -8,15 +8,11 @@
  * @author Phat Tran
  */
 
-#include <queue>
 #include <iostream>
 #include "Graph.h"
 
 using namespace std;
 
-// Constant representing the special index for the sink node in the graph
-const int SINK_NODE_INDEX = -1;
-
 /*
  * @brief Constructor for Graph class.
  * @pre None.
@@ -58,7 +54,7 @@ const vector<Node> &Graph::getNodes() const { return this->nodes; }
 const Node &Graph::getNode(int index) const
 {
     // Check if index is out of range
-    if (index < 0 || index >= this->nodes.size())
+    if (index < 0 || index >= static_cast<int>(this->nodes.size()))
     {
         cerr << "Error: Index out of range, returning the first node." << endl;
         return this->nodes.front();
@@ -67,6 +63,24 @@ const Node &Graph::getNode(int index) const
     // Return the node at the specified index
     return this->nodes[index];
 }
+
+/*
+ * @brief Get the node with a given index, whether or not the source and sink have been added.
+ * @param index The index of the node, as returned by Node::getIndex.
+ * @return The node with that index.
+ * @pre The Graph object must exist.
+ * @post The node with that index is returned.
+ */
+const Node &Graph::getNodeByIndex(int index) const
+{
+    // Nodes are stored in order of their indices, starting at 1, or at 0 once the source has been added
+    if (this->nodes.empty())
+    {
+        cerr << "Error: The graph has no nodes." << endl;
+        return this->nodes.front();
+    }
+    return getNode(index - this->nodes.front().getIndex());
+}
 // --------------------------------------------------------------------------------------------------------
 
 // ---------------------------------------- Edge-related functions ----------------------------------------
@@ -75,13 +89,15 @@ const Node &Graph::getNode(int index) const
  * @param source The index of the source node.
  * @param destination The index of the destination node.
  * @param hasFlow A boolean indicating if the edge has initial flow.
+ * @param capacity The capacity of the edge, optional with a default of 1.
+ * @param weight The cost of one unit of flow on the edge, optional with a default of 0.
  * @pre The Graph object must exist.
- * @post An edge with the specified source, destination, and flow status is added to the graph.
+ * @post An edge with the specified source, destination, flow status, capacity, and weight is added to the graph.
  */
-void Graph::addEdge(int source, int destination, bool hasFlow)
+void Graph::addEdge(int source, int destination, bool hasFlow, int capacity, int weight)
 {
     // Create and add a new Edge to the edges vector
-    Edge edge(source, destination, hasFlow);
+    Edge edge(source, destination, hasFlow, capacity, weight);
     this->edges.push_back(edge);
 }
 
@@ -92,6 +108,7 @@ void Graph::addEdge(int source, int destination, bool hasFlow)
  * @post A vector of all edges in the graph is returned.
  */
 const vector<Edge> &Graph::getEdges() const { return this->edges; }
+
 // --------------------------------------------------------------------------------------------------------
 
 // ----------------------------------- Residual graph-related functions -----------------------------------
@@ -105,35 +122,32 @@ void Graph::createResidualGraph()
     // Calculate total number of nodes and divide into left and right partitions
     int totalNodes = static_cast<int>(this->nodes.size());
     int leftPartition = totalNodes / 2;
+    int sinkNodeIndex = totalNodes + 1;
 
-    // Initialize the residual graph with empty adjacency lists
-    int totalResidualGraphNodes = totalNodes + 2;
-    this->residualGraph.resize(totalResidualGraphNodes);
+    // The residual graph holds every node plus the source (0) and the sink (totalNodes + 1)
+    this->residualNetwork = ResidualNetwork(totalNodes + 2);
 
-    // Connect source node (0) to nodes in the left partition (1 to leftPartition)
-    for (int i = 1; i <= leftPartition; i++)
+    // Create residual graph from existing edges, so that edge i of the graph is edge i of the residual graph
+    for (int i = 0; i < static_cast<int>(this->edges.size()); i++)
     {
-        this->residualGraph[0].push_back(i);
+        const Edge &edge = this->edges[i];
+        this->residualNetwork.addEdge(edge.getSourceIndex(), edge.getDestinationIndex(), 1, edge.getWeight());
     }
 
-    // Create residual graph from existing edges
-    for (int i = 0; i < this->edges.size(); i++)
+    // Connect source node (0) to nodes in the left partition (1 to leftPartition)
+    for (int i = 1; i <= leftPartition; i++)
     {
-        Edge edge = this->edges[i];
-        int sourceIndex = edge.getSourceIndex();
-        int destIndex = edge.getDestinationIndex();
-        this->residualGraph[sourceIndex].push_back(destIndex);
+        this->residualNetwork.addEdge(0, i, 1);
     }
 
     // Connect nodes in the right partition (leftPartition + 1 to totalNodes) to the sink node (totalNodes + 1)
     for (int i = leftPartition + 1; i <= totalNodes; i++)
     {
-        this->residualGraph[i].push_back(totalNodes + 1);
+        this->residualNetwork.addEdge(i, sinkNodeIndex, 1);
     }
 
-    // Connect the sink node to a special node (-1) to represent infinity
-    int sinkNodeIndex = totalNodes + 1;
-    this->residualGraph[sinkNodeIndex].push_back(-1);
+    // Lay out the arcs, each paired with its reverse arc
+    this->residualNetwork.build();
 
     // Add source node (with empty name, index 0, and level 0)
     Node sourceNode("", 0, 0);
@@ -145,224 +159,88 @@ void Graph::createResidualGraph()
 }
 
 /*
- * @brief Update the residual graph based on a given augmenting path.
- * @param augmentingPath A vector representing the augmenting path.
- * @pre The Graph object must exist.
- * @post The residual graph is updated using the given augmenting path.
+ * @brief Create the residual graph of the edges alone, for a flow between two nodes of the graph.
+ * @pre The Graph object must exist, without a source or a sink added.
+ * @post The residual graph holds one arc pair per edge, with the capacity of the edge; node indices are unchanged.
  */
-void Graph::updateResidualGraph(const vector<int> &augmentingPath)
+void Graph::createFlowNetwork()
 {
-    // Iterate through the nodes in the given path
-    for (int i = 0; i < augmentingPath.size() - 1; i++)
-    {
-        // Current node in the path
-        int currentNode = augmentingPath[i];
-
-        // Next node in the path
-        int nextNodeIndex = i + 1;
-        int nextNode = augmentingPath[nextNodeIndex];
-
-        // Find the edge in the residual graph
-        vector<int>::iterator it = find(this->residualGraph[currentNode].begin(), this->residualGraph[currentNode].end(), nextNode);
-
-        // Check if the edge is found in the residual graph
-        if (it != residualGraph[currentNode].end())
-        {
-            // Reverse the edge if it exists in the residual graph
-            // Remove the forward edge (currentNode -> nextNode) and add the reverse edge (nextNode -> currentNode)
-            this->residualGraph[currentNode].erase(it);
-            this->residualGraph[nextNode].push_back(currentNode);
-        }
-    }
-}
-// --------------------------------------------------------------------------------------------------------
-
-// ------------------------------------ Level graph-related functions -------------------------------------
-/*
- * @brief Create the residual graph based on the current graph's edges.
- * @pre The Graph object must exist.
- * @post The residual graph is created and updated based on the original graph's edges.
- */
-bool Graph::createLevelGraph()
-{
-    // Check if the graph is empty
-    if (nodes.empty())
-    {
-        cout << "Message: The residual graph is empty." << endl;
-        return false;
-    }
-
-    // Flag indicating whether a path to the sink node exists
-    bool hasPathToSink = false;
-
-    // Create a copy of the residual graph for level tracking
-    this->levelGraph = this->residualGraph;
-
-    // Mark nodes as visited during BFS
-    vector<bool> visited(nodes.size(), false);
-
-    // Start BFS from the source node
-    queue<Node> nodeQueue;
-    nodeQueue.push(nodes[0]);
+    // Nodes keep their indices 1 to totalNodes; index 0 is left unused
+    int totalNodes = static_cast<int>(this->nodes.size());
+    this->residualNetwork = ResidualNetwork(totalNodes + 1);
 
-    while (!nodeQueue.empty())
+    // Edge i of the graph is edge i of the residual graph
+    for (int i = 0; i < static_cast<int>(this->edges.size()); i++)
     {
-        const Node &currentNode = nodeQueue.front();
-        const int currentLevel = currentNode.getLevel();
-        const int currentIndex = currentNode.getIndex();
-        nodeQueue.pop();
-
-        // Get the adjacent nodes in the current level
-        const vector<int> &currentLevelGraph = levelGraph[currentIndex];
-        int numAdjacentNodes = static_cast<int>(currentLevelGraph.size());
-
-        for (int i = 0; i < numAdjacentNodes; i++)
-        {
-            const int adjancentIndex = currentLevelGraph[i]; // Index of the adjacent node
-
-            // Check if the sink node is reached
-            if (adjancentIndex == SINK_NODE_INDEX)
-            {
-                hasPathToSink = true;
-                break;
-            }
-            // Explore unvisited nodes
-            else if (!visited[adjancentIndex])
-            {
-                visited[adjancentIndex] = true;                   // Mark the adjacent node as visited
-                nodes[adjancentIndex].setLevel(currentLevel + 1); // Set the level of the adjacent node to the current level + 1
-                nodeQueue.push(nodes[adjancentIndex]);            // Add the adjacent node to the queue
-            }
-            // Remove backward edges to nodes at lower levels
-            else if (nodes[adjancentIndex].getLevel() < currentLevel + 1)
-            {
-                levelGraph[currentIndex].erase(currentLevelGraph.begin() + i);
-            }
-        }
-
-        // Mark the current node as visited
-        visited[currentIndex] = true;
+        const Edge &edge = this->edges[i];
+        this->residualNetwork.addEdge(edge.getSourceIndex(), edge.getDestinationIndex(), edge.getCapacity(), edge.getWeight());
     }
 
-    return hasPathToSink;
+    // Lay out the arcs, each paired with its reverse arc
+    this->residualNetwork.build();
 }
 
 /*
- * @brief Update the level graph based on a given augmenting path.
- * @param augmentingPath A vector representing the augmenting path.
- * @pre The Graph object must exist.
- * @post The level graph is updated using the given augmenting path.
+ * @brief Get the residual graph.
+ * @return The residual graph, with the source at index 0 and the sink at index nodeCount + 1.
+ * @pre The residual graph has been created.
+ * @post The residual graph is returned.
  */
-void Graph::updateLevelGraph(const vector<int> &augmentingPath)
-{
-    for (int i = 0; i < augmentingPath.size() - 1; i++)
-    {
-        // Current node in the path
-        int currentNode = augmentingPath[i];
-
-        // Next node in the path
-        int nextNodeIndex = i + 1;
-        int nextNode = augmentingPath[nextNodeIndex];
-
-        // Find the edge in the level graph and delete it
-        vector<int>::iterator it = find(this->levelGraph[currentNode].begin(), this->levelGraph[currentNode].end(), nextNode);
-
-        // Check if the edge is found in the level graph
-        if (it != levelGraph[currentNode].end())
-        {
-            // Delete the edge from the level graph
-            this->levelGraph[currentNode].erase(it);
-        }
-    }
-}
-
-/*
- * @brief Get the level graph.
- * @return A vector of vectors representing the level graph.
- * @pre The Graph object must exist.
- * @post A vector of vectors representing the level graph is returned.
- */
-const vector<int> &Graph::getLevelGraphAt(int index) const
-{
-    // Check if the index is within the valid range
-    if (index < 0 || index >= this->levelGraph.size())
-    {
-        cerr << "Error: Index out of range, returning the level graph of the first node." << endl;
-        return this->levelGraph.front();
-    }
-
-    // Return the level graph for the specified node
-    return this->levelGraph[index];
-}
+const ResidualNetwork &Graph::getResidualNetwork() const { return this->residualNetwork; }
 
 /*
- * @brief Get the level graph at a specific index.
- * @param index The index of the level graph to retrieve.
- * @return A vector representing the level graph at the specified index.
- * @pre The Graph object must exist.
- * @post A vector representing the level graph at the specified index is returned.
+ * @brief Get the residual graph for an algorithm that pushes flow through it.
+ * @return The residual graph, with the source at index 0 and the sink at index nodeCount + 1.
+ * @pre The residual graph has been created.
+ * @post The residual graph is returned; read the final flow with getFlow or createMatching.
  */
-const vector<vector<int>> &Graph::getLevelGraph() const { return this->levelGraph; }
+ResidualNetwork &Graph::getResidualNetwork() { return this->residualNetwork; }
 // --------------------------------------------------------------------------------------------------------
 
 // ---------------------------------------- Flow-related functions ----------------------------------------
 /*
- * @brief Augment the flow in the graph based on a given augmenting path.
- * @param augmentingPath A vector representing the augmenting path.
- * @pre The Graph object must exist.
- * @post The flow in the graph is augmented using the given augmenting path.
+ * @brief Create the matching given by the flow in the residual graph.
+ * @return The matching, with a pair for every edge that carries flow.
+ * @pre The residual graph has been created.
+ * @post None.
  */
-void Graph::augmentFlow(const vector<int> &augmentingPath)
+Matching Graph::createMatching() const
 {
-    // Iterate through the nodes in the augmenting path
-    for (int i = 0; i < augmentingPath.size() - 1; i++)
+    // The residual graph holds every node plus the source and the sink
+    Matching matching(this->residualNetwork.getNodeCount() - 2);
+    for (int i = 0; i < static_cast<int>(this->edges.size()); i++)
     {
-        // Current node in the path
-        int currentNode = augmentingPath[i];
-
-        // Next node in the path
-        int nextNodeIndex = i + 1;
-        int nextNode = augmentingPath[nextNodeIndex];
-
-        // Find the corresponding edge in the graph and augment its flow
-        for (Edge &edge : this->edges)
+        if (this->residualNetwork.getFlow(i) > 0)
         {
-            // Check if the edge is in the direction of the augmenting path
-            if (edge.getSourceIndex() == currentNode && edge.getDestinationIndex() == nextNode)
-            {
-                edge.setFlow(true); // Set the flow as true (augmenting the flow)
-            }
-            // Check if the edge is in the reverse direction of the augmenting path
-            else if (edge.getSourceIndex() == nextNode && edge.getDestinationIndex() == currentNode)
-            {
-                edge.setFlow(false); // Set the flow as false (decreasing the flow)
-            }
+            matching.addPair(this->edges[i].getSourceIndex(), this->edges[i].getDestinationIndex(), i);
         }
     }
+    return matching;
 }
 
 /*
- * @brief Remove a node and its incoming edges from the graph.
- * @param nodeIndex The index of the node to be removed.
- * @pre The Graph object must exist.
- * @post The specified node and its incoming edges are removed from the graph.
+ * @brief Route one unit of flow through the residual graph for every pair of a matching.
+ * @param matching The matching, over the nodes of the graph without the source and the sink.
+ * @pre The residual graph has been created and carries no flow.
+ * @post The edge of each pair, the arc from the source to its left node and the arc from its right node to the sink carry flow.
  */
-void Graph::removeNodeAndIncomingEdges(int nodeIndex)
+void Graph::applyMatching(const Matching &matching)
 {
-    // Delete the current node from the level graph
-    this->levelGraph[nodeIndex].clear();
-
-    // Delete all incoming edges to the current node
-    for (int i = 0; i < this->levelGraph.size(); i++)
+    // The input edges come first, then one edge from the source to each left node, then one from each right node to the sink
+    const int edgeCount = static_cast<int>(this->edges.size());
+    const int leftPartition = (this->residualNetwork.getNodeCount() - 2) / 2;
+    for (int left = 1; left <= leftPartition; left++)
     {
-        // Find the incoming edge in the adjacency list of each node
-        vector<int>::iterator it = find(this->levelGraph[i].begin(), this->levelGraph[i].end(), nodeIndex);
-
-        // If the incoming edge is found, remove it from the adjacency list
-        if (it != this->levelGraph[i].end())
+        int edge = matching.getMatchedEdge(left);
+        if (edge == -1)
         {
-            this->levelGraph[i].erase(it);
+            continue;
         }
+        int right = matching.getMate(left);
+        this->residualNetwork.pushFlow(this->residualNetwork.getEdgeArc(edgeCount + left - 1), 1);
+        this->residualNetwork.pushFlow(this->residualNetwork.getEdgeArc(edge), 1);
+        this->residualNetwork.pushFlow(this->residualNetwork.getEdgeArc(edgeCount + right - 1), 1);
     }
 }
+
 // --------------------------------------------------------------------------------------------------------
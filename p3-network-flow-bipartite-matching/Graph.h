@@ -13,6 +13,8 @@
 #include <vector>
 #include "Node.h"
 #include "Edge.h"
+#include "ResidualNetwork.h"
+#include "Matching.h"
 
 /*
  * @brief Class representing a graph.
@@ -59,6 +61,15 @@ public:
      * @post The node at the specified index is returned.
      */
     const Node &getNode(int index) const;
+
+    /*
+     * @brief Get the node with a given index, whether or not the source and sink have been added.
+     * @param index The index of the node, as returned by Node::getIndex.
+     * @return The node with that index.
+     * @pre The Graph object must exist.
+     * @post The node with that index is returned.
+     */
+    const Node &getNodeByIndex(int index) const;
     // --------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------- Edge-related functions ----------------------------------------
@@ -67,10 +78,12 @@ public:
      * @param source The index of the source node.
      * @param destination The index of the destination node.
      * @param hasFlow A boolean indicating if the edge has initial flow.
+     * @param capacity The capacity of the edge, optional with a default of 1.
+     * @param weight The cost of one unit of flow on the edge, optional with a default of 0.
      * @pre The Graph object must exist.
-     * @post An edge with the specified source, destination, and flow status is added to the graph.
+     * @post An edge with the specified source, destination, flow status, capacity, and weight is added to the graph.
      */
-    void addEdge(int source, int destination, bool hasFlow);
+    void addEdge(int source, int destination, bool hasFlow, int capacity = 1, int weight = 0);
 
     /*
      * @brief Get all the edges in the graph.
@@ -90,70 +103,49 @@ public:
     void createResidualGraph();
 
     /*
-     * @brief Update the residual graph based on a given augmenting path.
-     * @param augmentingPath A vector representing the augmenting path.
-     * @pre The Graph object must exist.
-     * @post The residual graph is updated using the given augmenting path.
-     */
-    void updateResidualGraph(const std::vector<int> &augmentingPath);
-    // --------------------------------------------------------------------------------------------------------
-
-    // ------------------------------------ Level graph-related functions -------------------------------------
-    /*
-     * @brief Create the level graph based on the current graph's structure.
-     * @return A boolean indicating whether a level graph could be created.
-     * @pre The Graph object must exist.
-     * @post If successful, a level graph is created based on the original graph's structure.
+     * @brief Create the residual graph of the edges alone, for a flow between two nodes of the graph.
+     * @pre The Graph object must exist, without a source or a sink added.
+     * @post The residual graph holds one arc pair per edge, with the capacity of the edge; node indices are unchanged.
      */
-    bool createLevelGraph();
+    void createFlowNetwork();
 
     /*
-     * @brief Update the level graph based on a given augmenting path.
-     * @param augmentingPath A vector representing the augmenting path.
-     * @pre The Graph object must exist.
-     * @post The level graph is updated using the given augmenting path.
+     * @brief Get the residual graph.
+     * @return The residual graph, with the source at index 0 and the sink at index nodeCount + 1.
+     * @pre The residual graph has been created.
+     * @post The residual graph is returned.
      */
-    void updateLevelGraph(const std::vector<int> &augmentingPath);
+    const ResidualNetwork &getResidualNetwork() const;
 
     /*
-     * @brief Get the level graph.
-     * @return A vector of vectors representing the level graph.
-     * @pre The Graph object must exist.
-     * @post A vector of vectors representing the level graph is returned.
+     * @brief Get the residual graph for an algorithm that pushes flow through it.
+     * @return The residual graph, with the source at index 0 and the sink at index nodeCount + 1.
+     * @pre The residual graph has been created.
+     * @post The residual graph is returned; read the final flow with getFlow or createMatching.
      */
-    const std::vector<std::vector<int>> &getLevelGraph() const;
-
-    /*
-     * @brief Get the level graph at a specific index.
-     * @param index The index of the level graph to retrieve.
-     * @return A vector representing the level graph at the specified index.
-     * @pre The Graph object must exist.
-     * @post A vector representing the level graph at the specified index is returned.
-     */
-    const std::vector<int> &getLevelGraphAt(int index) const;
+    ResidualNetwork &getResidualNetwork();
     // --------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------- Flow-related functions ----------------------------------------
     /*
-     * @brief Augment the flow in the graph based on a given augmenting path.
-     * @param augmentingPath A vector representing the augmenting path.
-     * @pre The Graph object must exist.
-     * @post The flow in the graph is augmented using the given augmenting path.
+     * @brief Create the matching given by the flow in the residual graph.
+     * @return The matching, with a pair for every edge that carries flow.
+     * @pre The residual graph has been created.
+     * @post None.
      */
-    void augmentFlow(const std::vector<int> &augmentingPath);
+    Matching createMatching() const;
 
     /*
-     * @brief Remove a node and its incoming edges from the graph.
-     * @param nodeIndex The index of the node to be removed.
-     * @pre The Graph object must exist.
-     * @post The specified node and its incoming edges are removed from the graph.
+     * @brief Route one unit of flow through the residual graph for every pair of a matching.
+     * @param matching The matching, over the nodes of the graph without the source and the sink.
+     * @pre The residual graph has been created and carries no flow.
+     * @post The edge of each pair, the arc from the source to its left node and the arc from its right node to the sink carry flow.
      */
-    void removeNodeAndIncomingEdges(int nodeIndex);
+    void applyMatching(const Matching &matching);
     // --------------------------------------------------------------------------------------------------------
 
 private:
-    std::vector<Edge> edges;                     // Edges in the graph.
-    std::vector<Node> nodes;                     // Nodes in the graph.
-    std::vector<std::vector<int>> residualGraph; // Residual graph.
-    std::vector<std::vector<int>> levelGraph;    // Level graph.
+    std::vector<Edge> edges;         // Edges in the graph.
+    std::vector<Node> nodes;         // Nodes in the graph.
+    ResidualNetwork residualNetwork; // Residual graph.
 };
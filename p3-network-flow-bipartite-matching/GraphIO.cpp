@@ -0,0 +1,184 @@
+/*
+ * @file GraphIO.cpp
+ * @brief Implementation of the GraphIO class functions.
+ *
+ * This file contains the implementation of the functions declared in the GraphIO class. Edges are read one line
+ * at a time so that the capacity is optional, and the results are printed with one flush at the end.
+ *
+ * @author Phat Tran
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include "GraphIO.h"
+
+using namespace std;
+
+/*
+ * @brief Load a graph from an input file.
+ * @param fileName The name of the input file.
+ * @param graph The graph to add the nodes and edges to.
+ * @param source Receives the index of the source node, or -1 for a bipartite matching input.
+ * @param sink Receives the index of the sink node, or -1 for a bipartite matching input.
+ * @return True if the file was read, false if it cannot be opened or names an invalid source or sink.
+ * @pre The graph is empty.
+ * @post The graph holds the nodes, with indices 1 to the node count, and the edges of the file, without flow.
+ */
+bool GraphIO::loadGraph(const string &fileName, Graph &graph, int &source, int &sink)
+{
+    ifstream inputFile(fileName);
+
+    // Check if the file was opened successfully
+    if (!inputFile.is_open())
+    {
+        cerr << "Error: Cannot open " << fileName << " file." << endl;
+        return false;
+    }
+
+    // Load the nodes from the input file
+    int nodeCount;
+    inputFile >> nodeCount;
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        // Read the name of the node from the input file
+        string nodeName;
+        inputFile >> nodeName;
+
+        // Create a new node with the read information and add it to the graph
+        Node newNode(nodeName, i + 1, 0);
+        graph.addNode(newNode);
+    }
+
+    // Load the edges from the input file
+    int edgeCount;
+    inputFile >> edgeCount;
+
+    // The numbers after the node indices are only interpreted once the kind of input is known
+    vector<int> sourceIndices, destinationIndices, firstValues, secondValues;
+    vector<bool> hasFirstValue;
+    string line;
+    getline(inputFile, line);
+    for (int i = 0; i < edgeCount && getline(inputFile, line); i++)
+    {
+        // Read the source and destination indices (1-based indexing) and up to two optional values
+        istringstream edgeLine(line);
+        int sourceIndex, destinationIndex, firstValue = 0, secondValue = 0;
+        if (!(edgeLine >> sourceIndex >> destinationIndex))
+        {
+            i--; // Skip blank lines
+            continue;
+        }
+        hasFirstValue.push_back(static_cast<bool>(edgeLine >> firstValue));
+        edgeLine >> secondValue;
+
+        sourceIndices.push_back(sourceIndex);
+        destinationIndices.push_back(destinationIndex);
+        firstValues.push_back(firstValue);
+        secondValues.push_back(secondValue);
+    }
+
+    // A flow input names its source and sink after the edges
+    source = -1;
+    sink = -1;
+    if (inputFile >> source >> sink)
+    {
+        if (source < 1 || source > nodeCount || sink < 1 || sink > nodeCount || source == sink)
+        {
+            cerr << "Error: The source and the sink must be two different nodes between 1 and " << nodeCount << "." << endl;
+            return false;
+        }
+    }
+    else
+    {
+        source = -1;
+        sink = -1;
+    }
+
+    for (int i = 0; i < static_cast<int>(sourceIndices.size()); i++)
+    {
+        // A flow edge reads "u v [capacity [cost]]", a matching edge reads "u v [weight]"
+        int capacity = 1, weight = 0;
+        if (source != -1)
+        {
+            capacity = hasFirstValue[i] ? firstValues[i] : 1;
+            weight = secondValues[i];
+        }
+        else if (hasFirstValue[i])
+        {
+            weight = firstValues[i];
+        }
+
+        // Convert to 0-based indexing
+        int sourceIndex = sourceIndices[i] - 1;
+        int destinationIndex = destinationIndices[i] - 1;
+
+        // Add an edge to the graph with no flow initially (false)
+        graph.addEdge(graph.getNode(sourceIndex).getIndex(), graph.getNode(destinationIndex).getIndex(), false, capacity, weight);
+    }
+
+    inputFile.close();
+    return true;
+}
+
+/*
+ * @brief Print a matching, one pair per line, followed by the number of pairs.
+ * @param graph The graph the matching belongs to.
+ * @param matching The matching, whose left set is the first half of the nodes.
+ * @pre None.
+ * @post The pairs are printed to standard output in order of their left nodes.
+ */
+void GraphIO::printMatching(const Graph &graph, const Matching &matching)
+{
+    // Print the matches, one per matched node of the left set
+    for (int leftIndex = 1; leftIndex <= matching.getNodeCount() / 2; leftIndex++)
+    {
+        int rightIndex = matching.getMate(leftIndex);
+        if (rightIndex != -1)
+        {
+            // Output the matched pair of nodes
+            cout << graph.getNodeByIndex(leftIndex).getName() << " / " << graph.getNodeByIndex(rightIndex).getName() << '\n';
+        }
+    }
+
+    // Output the total number of matches
+    cout << matching.size() << " total matches" << endl;
+}
+
+/*
+ * @brief Print the flow on every edge that carries flow, followed by the value of the flow.
+ * @param graph The graph, whose residual network carries the flow.
+ * @param flowValue The value of the flow.
+ * @pre The residual network of the graph was created with Graph::createFlowNetwork.
+ * @post The flows are printed to standard output in the order of the edges.
+ */
+void GraphIO::printFlow(const Graph &graph, long long flowValue)
+{
+    const vector<Edge> &edges = graph.getEdges();
+    const ResidualNetwork &network = graph.getResidualNetwork();
+    for (int i = 0; i < static_cast<int>(edges.size()); i++)
+    {
+        int flow = network.getFlow(i);
+        if (flow > 0)
+        {
+            // Output the edge with its flow and capacity
+            cout << graph.getNodeByIndex(edges[i].getSourceIndex()).getName() << " -> " << graph.getNodeByIndex(edges[i].getDestinationIndex()).getName()
+                 << ": " << flow << " / " << edges[i].getCapacity() << '\n';
+        }
+    }
+
+    // Output the value of the flow
+    cout << flowValue << " total flow" << endl;
+}
+
+/*
+ * @brief Print the total cost of a matching or a flow.
+ * @param totalCost The sum of the weights of the matched edges, or of the cost of every unit of flow.
+ * @pre None.
+ * @post The cost is printed to standard output.
+ */
+void GraphIO::printCost(long long totalCost)
+{
+    cout << totalCost << " total cost" << endl;
+}
@@ -0,0 +1,63 @@
+/*
+ * @file GraphIO.h
+ * @brief Declaration of the GraphIO class, which loads graphs from input files and prints the results of the engines.
+ *
+ * This file defines the GraphIO class, shared by the matching and the flow programs. The input format lists the
+ * number of nodes, their names, the number of edges, and one edge per line as two 1-based node indices. A bipartite
+ * matching input ends there, and each edge may be followed by an integer weight, the cost of matching its nodes.
+ * A flow input ends with one more line holding the 1-based indices of the source and the sink, and each edge may be
+ * followed by an integer capacity and then an integer cost per unit of flow.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <string>
+#include "Graph.h"
+#include "Matching.h"
+
+/*
+ * @brief Class providing the input and output of the network flow programs.
+ */
+class GraphIO
+{
+public:
+    /*
+     * @brief Load a graph from an input file.
+     * @param fileName The name of the input file.
+     * @param graph The graph to add the nodes and edges to.
+     * @param source Receives the index of the source node, or -1 for a bipartite matching input.
+     * @param sink Receives the index of the sink node, or -1 for a bipartite matching input.
+     * @return True if the file was read, false if it cannot be opened or names an invalid source or sink.
+     * @pre The graph is empty.
+     * @post The graph holds the nodes, with indices 1 to the node count, and the edges of the file, without flow.
+     */
+    static bool loadGraph(const std::string &fileName, Graph &graph, int &source, int &sink);
+
+    /*
+     * @brief Print a matching, one pair per line, followed by the number of pairs.
+     * @param graph The graph the matching belongs to.
+     * @param matching The matching, whose left set is the first half of the nodes.
+     * @pre None.
+     * @post The pairs are printed to standard output in order of their left nodes.
+     */
+    static void printMatching(const Graph &graph, const Matching &matching);
+
+    /*
+     * @brief Print the flow on every edge that carries flow, followed by the value of the flow.
+     * @param graph The graph, whose residual network carries the flow.
+     * @param flowValue The value of the flow.
+     * @pre The residual network of the graph was created with Graph::createFlowNetwork.
+     * @post The flows are printed to standard output in the order of the edges.
+     */
+    static void printFlow(const Graph &graph, long long flowValue);
+
+    /*
+     * @brief Print the total cost of a matching or a flow.
+     * @param totalCost The sum of the weights of the matched edges, or of the cost of every unit of flow.
+     * @pre None.
+     * @post The cost is printed to standard output.
+     */
+    static void printCost(long long totalCost);
+};
@@ -0,0 +1,274 @@
+/*
+ * @file HopcroftKarpAlgorithm.cpp
+ * @brief Implementation of the HopcroftKarpAlgorithm class functions.
+ *
+ * This file contains the implementation of the functions declared in the HopcroftKarpAlgorithm class. Left and right
+ * nodes are renumbered from 0 within their own sets, and the edges are laid out as a compressed adjacency array of
+ * the left nodes. The depth-first search of each phase is iterative, with a current entry per left node that only
+ * moves forward, so every edge is scanned at most once per phase.
+ *
+ * @author Phat Tran
+ */
+
+#include <iostream>
+#include "HopcroftKarpAlgorithm.h"
+
+using namespace std;
+
+/*
+ * @brief Find a maximum matching of a bipartite graph.
+ * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose edges lead from the left set to the right set.
+ * @param nodeCount The number of nodes in the graph, without a source or a sink.
+ * @param matching A matching over the nodes 1 to nodeCount to start from, or an empty matching over no nodes; receives the maximum matching.
+ * @return The number of matched pairs.
+ * @pre nodeCount is even.
+ * @post No augmenting path remains for the matching.
+ */
+int HopcroftKarpAlgorithm::findMaximumMatching(const Graph &graph, int nodeCount, Matching &matching)
+{
+    const vector<Edge> &edges = graph.getEdges();
+    int leftCount = nodeCount / 2;
+    int rightCount = nodeCount - leftCount;
+
+    // Lay out the edges by left node, renumbering both sets from 0
+    vector<int> offsets(leftCount + 1, 0);
+    for (const Edge &edge : edges)
+    {
+        int left = edge.getSourceIndex() - 1;
+        int right = edge.getDestinationIndex() - leftCount - 1;
+        if (left < 0 || left >= leftCount || right < 0 || right >= rightCount)
+        {
+            cerr << "Error: Edge " << edge.getSourceIndex() << " -> " << edge.getDestinationIndex() << " does not lead from the left set to the right set, ignoring it." << endl;
+            continue;
+        }
+        offsets[left + 1]++;
+    }
+    for (int left = 0; left < leftCount; left++)
+    {
+        offsets[left + 1] += offsets[left];
+    }
+    vector<int> nextEntry(offsets.begin(), offsets.end() - 1);
+    vector<int> adjacentNodes(offsets[leftCount]), adjacentEdges(offsets[leftCount]);
+    for (int i = 0; i < static_cast<int>(edges.size()); i++)
+    {
+        int left = edges[i].getSourceIndex() - 1;
+        int right = edges[i].getDestinationIndex() - leftCount - 1;
+        if (left >= 0 && left < leftCount && right >= 0 && right < rightCount)
+        {
+            adjacentNodes[nextEntry[left]] = right;
+            adjacentEdges[nextEntry[left]++] = i;
+        }
+    }
+
+    // Start from the given matching, then grow it one phase of shortest augmenting paths at a time
+    vector<int> matchL(leftCount, -1), matchR(rightCount, -1), matchedEntries(leftCount, -1);
+    vector<int> distances(leftCount), nodeQueue(leftCount), currentEntries(leftCount), pathNodes;
+    int matchCount = (matching.getNodeCount() == nodeCount) ? seedMatching(matching, offsets, adjacentEdges, adjacentNodes, matchL, matchR, matchedEntries) : 0;
+    int freeLayer;
+    while ((freeLayer = buildLayers(offsets, adjacentNodes, matchL, matchR, distances, nodeQueue)) != -1)
+    {
+        matchCount += augmentLayers(offsets, adjacentNodes, freeLayer, matchL, matchR, matchedEntries, distances, currentEntries, pathNodes);
+    }
+
+    // Report the matching in the node indices of the graph
+    matching = Matching(nodeCount);
+    for (int left = 0; left < leftCount; left++)
+    {
+        if (matchL[left] != -1)
+        {
+            matching.addPair(left + 1, matchL[left] + leftCount + 1, adjacentEdges[matchedEntries[left]]);
+        }
+    }
+
+    return matchCount;
+}
+
+/*
+ * @brief Copy a matching into the match arrays.
+ * @param matching The matching, over the nodes of the graph.
+ * @param offsets The first adjacency entry of each left node, followed by the number of entries.
+ * @param adjacentEdges The graph edge of each adjacency entry.
+ * @param adjacentNodes The right node of each adjacency entry.
+ * @param matchL Receives the right node matched to each left node.
+ * @param matchR Receives the left node matched to each right node.
+ * @param matchedEntries Receives the adjacency entry matching each left node.
+ * @return The number of pairs copied.
+ * @pre The match arrays are empty.
+ * @post Every pair whose edge leads from the left set to the right set is copied.
+ */
+int HopcroftKarpAlgorithm::seedMatching(const Matching &matching, const vector<int> &offsets, const vector<int> &adjacentEdges,
+                                        const vector<int> &adjacentNodes, vector<int> &matchL, vector<int> &matchR, vector<int> &matchedEntries)
+{
+    int pairCount = 0;
+    int leftCount = static_cast<int>(matchL.size());
+    for (int left = 0; left < leftCount; left++)
+    {
+        // Find the adjacency entry of the matching edge among the entries of the left node
+        int edge = matching.getMatchedEdge(left + 1);
+        for (int entry = offsets[left]; edge != -1 && entry < offsets[left + 1]; entry++)
+        {
+            if (adjacentEdges[entry] == edge)
+            {
+                matchL[left] = adjacentNodes[entry];
+                matchR[adjacentNodes[entry]] = left;
+                matchedEntries[left] = entry;
+                pairCount++;
+                break;
+            }
+        }
+    }
+
+    return pairCount;
+}
+
+/*
+ * @brief Layer the left nodes by the length of their shortest alternating path from a free left node.
+ * @param offsets The first adjacency entry of each left node, followed by the number of entries.
+ * @param adjacentNodes The right node of each adjacency entry.
+ * @param matchL The right node matched to each left node, or -1.
+ * @param matchR The left node matched to each right node, or -1.
+ * @param distances Receives the layer of each left node, or -1 if it lies on no shortest alternating path.
+ * @param nodeQueue Scratch space for the BFS queue.
+ * @return The layer of the left nodes that reach a free right node, or -1 if no augmenting path exists.
+ * @pre distances and nodeQueue hold one entry per left node.
+ * @post The layers are set.
+ */
+int HopcroftKarpAlgorithm::buildLayers(const vector<int> &offsets, const vector<int> &adjacentNodes, const vector<int> &matchL,
+                                       const vector<int> &matchR, vector<int> &distances, vector<int> &nodeQueue)
+{
+    // Every free left node starts a path at layer 0
+    int leftCount = static_cast<int>(matchL.size());
+    int queueEnd = 0;
+    for (int left = 0; left < leftCount; left++)
+    {
+        distances[left] = (matchL[left] == -1) ? 0 : -1;
+        if (matchL[left] == -1)
+        {
+            nodeQueue[queueEnd++] = left;
+        }
+    }
+
+    int freeLayer = -1;
+    for (int queueHead = 0; queueHead < queueEnd; queueHead++)
+    {
+        int left = nodeQueue[queueHead];
+
+        // Layers beyond the first free right node cannot hold a shortest augmenting path
+        if (freeLayer != -1 && distances[left] >= freeLayer)
+        {
+            break;
+        }
+
+        for (int entry = offsets[left]; entry < offsets[left + 1]; entry++)
+        {
+            int mate = matchR[adjacentNodes[entry]];
+            if (mate == -1)
+            {
+                // A free right node ends an augmenting path
+                if (freeLayer == -1)
+                {
+                    freeLayer = distances[left];
+                }
+            }
+            else if (distances[mate] == -1)
+            {
+                // A matched right node continues the path through its mate
+                distances[mate] = distances[left] + 1;
+                nodeQueue[queueEnd++] = mate;
+            }
+        }
+    }
+
+    return freeLayer;
+}
+
+/*
+ * @brief Augment along a maximal set of vertex-disjoint shortest alternating paths.
+ * @param offsets The first adjacency entry of each left node, followed by the number of entries.
+ * @param adjacentNodes The right node of each adjacency entry.
+ * @param freeLayer The layer returned by buildLayers.
+ * @param matchL The right node matched to each left node, or -1; updated along every augmenting path.
+ * @param matchR The left node matched to each right node, or -1; updated along every augmenting path.
+ * @param matchedEntries The adjacency entry matching each left node, or -1; updated along every augmenting path.
+ * @param distances The layers from buildLayers; left nodes that are dead ends are set to -1.
+ * @param currentEntries Scratch space for the next adjacency entry to try at each left node.
+ * @param pathNodes Scratch space for the left nodes of the current path.
+ * @return The number of augmenting paths found.
+ * @pre distances and freeLayer come from buildLayers on the current matching.
+ * @post No shortest alternating path remains.
+ */
+int HopcroftKarpAlgorithm::augmentLayers(const vector<int> &offsets, const vector<int> &adjacentNodes, int freeLayer,
+                                         vector<int> &matchL, vector<int> &matchR, vector<int> &matchedEntries,
+                                         vector<int> &distances, vector<int> &currentEntries, vector<int> &pathNodes)
+{
+    int leftCount = static_cast<int>(matchL.size());
+    for (int left = 0; left < leftCount; left++)
+    {
+        currentEntries[left] = offsets[left];
+    }
+
+    int pathCount = 0;
+    for (int root = 0; root < leftCount; root++)
+    {
+        if (matchL[root] != -1 || distances[root] != 0)
+        {
+            continue;
+        }
+
+        pathNodes.clear();
+        pathNodes.push_back(root);
+        while (!pathNodes.empty())
+        {
+            int left = pathNodes.back();
+            int &entry = currentEntries[left];
+            bool augmented = false;
+            bool advanced = false;
+
+            for (; entry < offsets[left + 1]; entry++)
+            {
+                int mate = matchR[adjacentNodes[entry]];
+                if (mate == -1 && distances[left] == freeLayer)
+                {
+                    augmented = true;
+                    break;
+                }
+                if (mate != -1 && distances[mate] == distances[left] + 1)
+                {
+                    advanced = true;
+                    break;
+                }
+            }
+
+            if (augmented)
+            {
+                // Flip the path: every left node on it takes the right node of its current entry
+                for (int pathLeft : pathNodes)
+                {
+                    int right = adjacentNodes[currentEntries[pathLeft]];
+                    matchL[pathLeft] = right;
+                    matchR[right] = pathLeft;
+                    matchedEntries[pathLeft] = currentEntries[pathLeft];
+                    distances[pathLeft] = -1; // The paths of a phase are vertex-disjoint
+                }
+                pathCount++;
+                break;
+            }
+            else if (advanced)
+            {
+                pathNodes.push_back(matchR[adjacentNodes[entry]]);
+            }
+            else
+            {
+                // Retreat: the left node is a dead end for the rest of the phase
+                distances[left] = -1;
+                pathNodes.pop_back();
+                if (!pathNodes.empty())
+                {
+                    currentEntries[pathNodes.back()]++;
+                }
+            }
+        }
+    }
+
+    return pathCount;
+}
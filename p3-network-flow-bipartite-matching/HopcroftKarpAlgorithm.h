@@ -0,0 +1,87 @@
+/*
+ * @file HopcroftKarpAlgorithm.h
+ * @brief Declaration of the HopcroftKarpAlgorithm class, the Hopcroft-Karp maximum bipartite matching algorithm.
+ *
+ * This file defines the HopcroftKarpAlgorithm class. It works directly on the edges from the left set to the right
+ * set, without a source, a sink or residual arcs. Each phase runs a BFS from all free left nodes that layers the
+ * left nodes by the length of their shortest alternating path, then augments along a maximal set of vertex-disjoint
+ * shortest alternating paths. There are O(sqrt(V)) phases, so the matching takes O(E sqrt(V)) time.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+#include "Graph.h"
+#include "Matching.h"
+
+/*
+ * @brief Class providing the Hopcroft-Karp maximum bipartite matching algorithm.
+ */
+class HopcroftKarpAlgorithm
+{
+public:
+    /*
+     * @brief Find a maximum matching of a bipartite graph.
+     * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose edges lead from the left set to the right set.
+     * @param nodeCount The number of nodes in the graph, without a source or a sink.
+     * @param matching A matching over the nodes 1 to nodeCount to start from, or an empty matching over no nodes; receives the maximum matching.
+     * @return The number of matched pairs.
+     * @pre nodeCount is even.
+     * @post No augmenting path remains for the matching.
+     */
+    static int findMaximumMatching(const Graph &graph, int nodeCount, Matching &matching);
+
+private:
+    /*
+     * @brief Copy a matching into the match arrays.
+     * @param matching The matching, over the nodes of the graph.
+     * @param offsets The first adjacency entry of each left node, followed by the number of entries.
+     * @param adjacentEdges The graph edge of each adjacency entry.
+     * @param adjacentNodes The right node of each adjacency entry.
+     * @param matchL Receives the right node matched to each left node.
+     * @param matchR Receives the left node matched to each right node.
+     * @param matchedEntries Receives the adjacency entry matching each left node.
+     * @return The number of pairs copied.
+     * @pre The match arrays are empty.
+     * @post Every pair whose edge leads from the left set to the right set is copied.
+     */
+    static int seedMatching(const Matching &matching, const std::vector<int> &offsets, const std::vector<int> &adjacentEdges,
+                            const std::vector<int> &adjacentNodes, std::vector<int> &matchL, std::vector<int> &matchR,
+                            std::vector<int> &matchedEntries);
+
+    /*
+     * @brief Layer the left nodes by the length of their shortest alternating path from a free left node.
+     * @param offsets The first adjacency entry of each left node, followed by the number of entries.
+     * @param adjacentNodes The right node of each adjacency entry.
+     * @param matchL The right node matched to each left node, or -1.
+     * @param matchR The left node matched to each right node, or -1.
+     * @param distances Receives the layer of each left node, or -1 if it lies on no shortest alternating path.
+     * @param nodeQueue Scratch space for the BFS queue.
+     * @return The layer of the left nodes that reach a free right node, or -1 if no augmenting path exists.
+     * @pre distances and nodeQueue hold one entry per left node.
+     * @post The layers are set.
+     */
+    static int buildLayers(const std::vector<int> &offsets, const std::vector<int> &adjacentNodes, const std::vector<int> &matchL,
+                           const std::vector<int> &matchR, std::vector<int> &distances, std::vector<int> &nodeQueue);
+
+    /*
+     * @brief Augment along a maximal set of vertex-disjoint shortest alternating paths.
+     * @param offsets The first adjacency entry of each left node, followed by the number of entries.
+     * @param adjacentNodes The right node of each adjacency entry.
+     * @param freeLayer The layer returned by buildLayers.
+     * @param matchL The right node matched to each left node, or -1; updated along every augmenting path.
+     * @param matchR The left node matched to each right node, or -1; updated along every augmenting path.
+     * @param matchedEntries The adjacency entry matching each left node, or -1; updated along every augmenting path.
+     * @param distances The layers from buildLayers; left nodes that are dead ends are set to -1.
+     * @param currentEntries Scratch space for the next adjacency entry to try at each left node.
+     * @param pathNodes Scratch space for the left nodes of the current path.
+     * @return The number of augmenting paths found.
+     * @pre distances and freeLayer come from buildLayers on the current matching.
+     * @post No shortest alternating path remains.
+     */
+    static int augmentLayers(const std::vector<int> &offsets, const std::vector<int> &adjacentNodes, int freeLayer,
+                             std::vector<int> &matchL, std::vector<int> &matchR, std::vector<int> &matchedEntries,
+                             std::vector<int> &distances, std::vector<int> &currentEntries, std::vector<int> &pathNodes);
+};
@@ -0,0 +1,145 @@
+/*
+ * @file HungarianAlgorithm.cpp
+ * @brief Implementation of the HungarianAlgorithm class functions.
+ *
+ * This file contains the implementation of the functions declared in the HungarianAlgorithm class. The cost matrix
+ * keeps the cheapest edge between each pair of nodes and a large penalty where there is none. The penalty exceeds
+ * twice the largest possible total weight of real edges, so trading a penalty pair for real ones always pays.
+ *
+ * @author Phat Tran
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "HungarianAlgorithm.h"
+
+using namespace std;
+
+/*
+ * @brief Find a maximum matching of minimum total weight.
+ * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose weighted edges lead from the left set to the right set.
+ * @param nodeCount The number of nodes in the graph, without a source or a sink.
+ * @param matching Receives the matching, over the nodes 1 to nodeCount.
+ * @return The total weight of the matched edges.
+ * @pre nodeCount is even and nodeCount / 2 is at most MAX_SIDE.
+ * @post The matching has the most pairs possible and, among such matchings, the least total weight.
+ */
+long long HungarianAlgorithm::findMinCostAssignment(const Graph &graph, int nodeCount, Matching &matching)
+{
+    const vector<Edge> &edges = graph.getEdges();
+    int size = nodeCount / 2;
+
+    // Penalty for a pair without an edge
+    long long largestWeight = 0;
+    for (const Edge &edge : edges)
+    {
+        largestWeight = max(largestWeight, static_cast<long long>(llabs(edge.getWeight())));
+    }
+    const long long missingCost = 2 * (largestWeight + 1) * (size + 1);
+
+    // Cost matrix, 1-based as in the row and column arrays below, holding the cheapest edge of each pair
+    vector<vector<long long>> costs(size + 1, vector<long long>(size + 1, missingCost));
+    for (const Edge &edge : edges)
+    {
+        int row = edge.getSourceIndex();
+        int column = edge.getDestinationIndex() - size;
+        if (row < 1 || row > size || column < 1 || column > size)
+        {
+            cerr << "Error: Edge " << edge.getSourceIndex() << " -> " << edge.getDestinationIndex() << " does not lead from the left set to the right set, ignoring it." << endl;
+            continue;
+        }
+        costs[row][column] = min(costs[row][column], static_cast<long long>(edge.getWeight()));
+    }
+
+    // rowPotentials and columnPotentials are the dual variables; columnRows[j] is the row assigned to column j
+    const long long INFINITE = numeric_limits<long long>::max() / 4;
+    vector<long long> rowPotentials(size + 1, 0), columnPotentials(size + 1, 0), minima(size + 1);
+    vector<int> columnRows(size + 1, 0), previousColumns(size + 1, 0);
+    vector<bool> used(size + 1);
+    for (int row = 1; row <= size; row++)
+    {
+        // Column 0 is a virtual column holding the row being added
+        columnRows[0] = row;
+        int column = 0;
+        fill(minima.begin(), minima.end(), INFINITE);
+        fill(used.begin(), used.end(), false);
+
+        // Grow a tree of tight edges until it reaches a free column
+        do
+        {
+            used[column] = true;
+            int currentRow = columnRows[column];
+            long long delta = INFINITE;
+            int nextColumn = 0;
+            for (int j = 1; j <= size; j++)
+            {
+                if (!used[j])
+                {
+                    long long reducedCost = costs[currentRow][j] - rowPotentials[currentRow] - columnPotentials[j];
+                    if (reducedCost < minima[j])
+                    {
+                        minima[j] = reducedCost;
+                        previousColumns[j] = column;
+                    }
+                    if (minima[j] < delta)
+                    {
+                        delta = minima[j];
+                        nextColumn = j;
+                    }
+                }
+            }
+
+            // Shift the potentials so that the cheapest edge leaving the tree becomes tight
+            for (int j = 0; j <= size; j++)
+            {
+                if (used[j])
+                {
+                    rowPotentials[columnRows[j]] += delta;
+                    columnPotentials[j] -= delta;
+                }
+                else
+                {
+                    minima[j] -= delta;
+                }
+            }
+            column = nextColumn;
+        } while (columnRows[column] != 0);
+
+        // Flip the alternating path back to the virtual column
+        do
+        {
+            int previousColumn = previousColumns[column];
+            columnRows[column] = columnRows[previousColumn];
+            column = previousColumn;
+        } while (column != 0);
+    }
+
+    // Report the pairs that use real edges, each through its cheapest edge
+    vector<int> assignedColumns(size + 1, 0);
+    for (int column = 1; column <= size; column++)
+    {
+        if (columnRows[column] != 0 && costs[columnRows[column]][column] != missingCost)
+        {
+            assignedColumns[columnRows[column]] = column;
+        }
+    }
+
+    matching = Matching(nodeCount);
+    long long totalCost = 0;
+    for (int i = 0; i < static_cast<int>(edges.size()); i++)
+    {
+        int row = edges[i].getSourceIndex();
+        int column = edges[i].getDestinationIndex() - size;
+        if (row >= 1 && row <= size && column >= 1 && column <= size && assignedColumns[row] == column &&
+            matching.getMate(row) == -1 && edges[i].getWeight() == costs[row][column])
+        {
+            matching.addPair(row, column + size, i);
+            totalCost += edges[i].getWeight();
+        }
+    }
+
+    return totalCost;
+}
@@ -0,0 +1,39 @@
+/*
+ * @file HungarianAlgorithm.h
+ * @brief Declaration of the HungarianAlgorithm class, the O(n^3) Hungarian algorithm for dense weighted assignment.
+ *
+ * This file defines the HungarianAlgorithm class. It solves the weighted assignment problem on a full cost matrix
+ * of the left set by the right set, adding one left node at a time and growing the assignment along a cheapest
+ * alternating path while dual potentials keep the reduced costs non-negative. It takes O(n^3) time and O(n^2)
+ * memory, which suits complete or nearly complete bipartite graphs. A pair without an edge costs more than any
+ * assignment of real edges, so the result is a maximum matching of minimum total weight, like the result of the
+ * successive shortest path engine.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include "Graph.h"
+#include "Matching.h"
+
+/*
+ * @brief Class providing the Hungarian algorithm for weighted bipartite matching.
+ */
+class HungarianAlgorithm
+{
+public:
+    // Largest number of nodes per side; the cost matrix of this many rows and columns takes 128 MiB.
+    static const int MAX_SIDE = 4096;
+
+    /*
+     * @brief Find a maximum matching of minimum total weight.
+     * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose weighted edges lead from the left set to the right set.
+     * @param nodeCount The number of nodes in the graph, without a source or a sink.
+     * @param matching Receives the matching, over the nodes 1 to nodeCount.
+     * @return The total weight of the matched edges.
+     * @pre nodeCount is even and nodeCount / 2 is at most MAX_SIDE.
+     * @post The matching has the most pairs possible and, among such matchings, the least total weight.
+     */
+    static long long findMinCostAssignment(const Graph &graph, int nodeCount, Matching &matching);
+};
@@ -0,0 +1,126 @@
+/*
+ * @file Matching.cpp
+ * @brief Implementation of the Matching class functions.
+ *
+ * This file contains the implementation of the functions declared in the Matching class. Both nodes of a pair
+ * store each other and the matching edge, so either side can be looked up or freed in constant time.
+ *
+ * @author Phat Tran
+ */
+
+#include <iostream>
+#include "Matching.h"
+
+using namespace std;
+
+/*
+ * @brief Constructor for Matching class.
+ * @param nodeCount The number of nodes, which are indexed from 1 to nodeCount, optional with a default of 0.
+ * @pre nodeCount >= 0.
+ * @post An empty matching of the nodes is created.
+ */
+Matching::Matching(int nodeCount) : mates(nodeCount + 1, -1), matchedEdges(nodeCount + 1, -1), pairCount(0) {}
+
+/*
+ * @brief Destructor for Matching class.
+ * @pre None.
+ * @post The Matching object and its associated resources are deallocated.
+ */
+Matching::~Matching() {}
+
+/*
+ * @brief Match two nodes.
+ * @param leftNode The index of the node in the left set.
+ * @param rightNode The index of the node in the right set.
+ * @param edgeIndex The index of the edge between them in Graph::getEdges().
+ * @return True if the pair was added, false if a node index is out of range.
+ * @pre None.
+ * @post The two nodes are matched to each other; any pair either of them belonged to before is removed.
+ */
+bool Matching::addPair(int leftNode, int rightNode, int edgeIndex)
+{
+    // Check if the nodes are out of range
+    if (leftNode < 1 || leftNode >= static_cast<int>(this->mates.size()) || rightNode < 1 || rightNode >= static_cast<int>(this->mates.size()) || leftNode == rightNode)
+    {
+        cerr << "Error: Cannot match node " << leftNode << " with node " << rightNode << ", ignoring the pair." << endl;
+        return false;
+    }
+
+    removePair(leftNode);
+    removePair(rightNode);
+    this->mates[leftNode] = rightNode;
+    this->mates[rightNode] = leftNode;
+    this->matchedEdges[leftNode] = edgeIndex;
+    this->matchedEdges[rightNode] = edgeIndex;
+    this->pairCount++;
+    return true;
+}
+
+/*
+ * @brief Remove the pair a node belongs to.
+ * @param node The index of the node.
+ * @pre None.
+ * @post The node and its former mate are free.
+ */
+void Matching::removePair(int node)
+{
+    int mate = getMate(node);
+    if (mate == -1)
+    {
+        return;
+    }
+
+    this->mates[node] = -1;
+    this->mates[mate] = -1;
+    this->matchedEdges[node] = -1;
+    this->matchedEdges[mate] = -1;
+    this->pairCount--;
+}
+
+/*
+ * @brief Get the mate of a node.
+ * @param node The index of the node.
+ * @return The index of the node it is matched to, or -1 if it is free or out of range.
+ * @pre None.
+ * @post None.
+ */
+int Matching::getMate(int node) const
+{
+    if (node < 1 || node >= static_cast<int>(this->mates.size()))
+    {
+        return -1;
+    }
+    return this->mates[node];
+}
+
+/*
+ * @brief Get the edge that matches a node.
+ * @param node The index of the node.
+ * @return The index of the matching edge in Graph::getEdges(), or -1 if the node is free or out of range.
+ * @pre None.
+ * @post None.
+ */
+int Matching::getMatchedEdge(int node) const
+{
+    if (node < 1 || node >= static_cast<int>(this->matchedEdges.size()))
+    {
+        return -1;
+    }
+    return this->matchedEdges[node];
+}
+
+/*
+ * @brief Get the number of nodes.
+ * @return The number of nodes the matching is over.
+ * @pre None.
+ * @post None.
+ */
+int Matching::getNodeCount() const { return static_cast<int>(this->mates.size()) - 1; }
+
+/*
+ * @brief Get the number of pairs.
+ * @return The number of matched pairs.
+ * @pre None.
+ * @post None.
+ */
+int Matching::size() const { return this->pairCount; }
@@ -0,0 +1,94 @@
+/*
+ * @file Matching.h
+ * @brief Declaration of the Matching class, representing a matching of a bipartite graph.
+ *
+ * This file defines the Matching class, which records for every node the node it is matched to and the edge that
+ * matches them. Looking up the mate of a node, adding a pair and removing a pair all take constant time, and the
+ * number of pairs is kept up to date, so a matching engine can report its result without scanning the edges.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+
+/*
+ * @brief Class representing a matching of a bipartite graph.
+ */
+class Matching
+{
+public:
+    /*
+     * @brief Constructor for Matching class.
+     * @param nodeCount The number of nodes, which are indexed from 1 to nodeCount, optional with a default of 0.
+     * @pre nodeCount >= 0.
+     * @post An empty matching of the nodes is created.
+     */
+    explicit Matching(int nodeCount = 0);
+
+    /*
+     * @brief Destructor for Matching class.
+     * @pre None.
+     * @post The Matching object and its associated resources are deallocated.
+     */
+    ~Matching();
+
+    /*
+     * @brief Match two nodes.
+     * @param leftNode The index of the node in the left set.
+     * @param rightNode The index of the node in the right set.
+     * @param edgeIndex The index of the edge between them in Graph::getEdges().
+     * @return True if the pair was added, false if a node index is out of range.
+     * @pre None.
+     * @post The two nodes are matched to each other; any pair either of them belonged to before is removed.
+     */
+    bool addPair(int leftNode, int rightNode, int edgeIndex);
+
+    /*
+     * @brief Remove the pair a node belongs to.
+     * @param node The index of the node.
+     * @pre None.
+     * @post The node and its former mate are free.
+     */
+    void removePair(int node);
+
+    /*
+     * @brief Get the mate of a node.
+     * @param node The index of the node.
+     * @return The index of the node it is matched to, or -1 if it is free or out of range.
+     * @pre None.
+     * @post None.
+     */
+    int getMate(int node) const;
+
+    /*
+     * @brief Get the edge that matches a node.
+     * @param node The index of the node.
+     * @return The index of the matching edge in Graph::getEdges(), or -1 if the node is free or out of range.
+     * @pre None.
+     * @post None.
+     */
+    int getMatchedEdge(int node) const;
+
+    /*
+     * @brief Get the number of nodes.
+     * @return The number of nodes the matching is over.
+     * @pre None.
+     * @post None.
+     */
+    int getNodeCount() const;
+
+    /*
+     * @brief Get the number of pairs.
+     * @return The number of matched pairs.
+     * @pre None.
+     * @post None.
+     */
+    int size() const;
+
+private:
+    std::vector<int> mates;        // Mate of each node, or -1; entry 0 is unused.
+    std::vector<int> matchedEdges; // Edge matching each node, or -1; entry 0 is unused.
+    int pairCount;                 // Number of matched pairs.
+};
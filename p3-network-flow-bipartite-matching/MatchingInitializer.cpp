@@ -0,0 +1,186 @@
+/*
+ * @file MatchingInitializer.cpp
+ * @brief Implementation of the MatchingInitializer class functions.
+ *
+ * This file contains the implementation of the functions declared in the MatchingInitializer class. Both heuristics
+ * number the nodes from 0 and work on one compressed adjacency array that lists each edge at both of its nodes.
+ * Karp-Sipser keeps, for every free node, the number of its edges that lead to free nodes. Matching a pair lowers
+ * the counts of their free neighbors, and a neighbor whose count drops to 1 is put on a stack. Stale entries on the
+ * stack are skipped when they are popped. Every edge is therefore scanned a constant number of times.
+ *
+ * @author Phat Tran
+ */
+
+#include "MatchingInitializer.h"
+
+using namespace std;
+
+/*
+ * @brief Match each left node to its first free neighbor.
+ * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose edges lead from the left set to the right set.
+ * @param nodeCount The number of nodes in the graph, without a source or a sink.
+ * @param matching Receives the matching, over the nodes 1 to nodeCount.
+ * @return The number of matched pairs.
+ * @pre nodeCount is even.
+ * @post The matching is maximal: no edge joins two free nodes.
+ */
+int MatchingInitializer::findGreedyMatching(const Graph &graph, int nodeCount, Matching &matching)
+{
+    vector<int> offsets, adjacentNodes, adjacentEdges;
+    buildAdjacency(graph, nodeCount, offsets, adjacentNodes, adjacentEdges);
+
+    matching = Matching(nodeCount);
+    for (int left = 0; left < nodeCount / 2; left++)
+    {
+        for (int entry = offsets[left]; entry < offsets[left + 1]; entry++)
+        {
+            int right = adjacentNodes[entry];
+            if (matching.getMate(right + 1) == -1)
+            {
+                matching.addPair(left + 1, right + 1, adjacentEdges[entry]);
+                break;
+            }
+        }
+    }
+
+    return matching.size();
+}
+
+/*
+ * @brief Match nodes with a single free neighbor first, and otherwise the first free node with its first free neighbor.
+ * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose edges lead from the left set to the right set.
+ * @param nodeCount The number of nodes in the graph, without a source or a sink.
+ * @param matching Receives the matching, over the nodes 1 to nodeCount.
+ * @return The number of matched pairs.
+ * @pre nodeCount is even.
+ * @post The matching is maximal: no edge joins two free nodes.
+ */
+int MatchingInitializer::findKarpSipserMatching(const Graph &graph, int nodeCount, Matching &matching)
+{
+    vector<int> offsets, adjacentNodes, adjacentEdges;
+    buildAdjacency(graph, nodeCount, offsets, adjacentNodes, adjacentEdges);
+
+    // Count the edges of every node, all of which lead to free nodes at the start
+    vector<int> mates(nodeCount, -1), degrees(nodeCount), degreeOneNodes;
+    for (int node = 0; node < nodeCount; node++)
+    {
+        degrees[node] = offsets[node + 1] - offsets[node];
+        if (degrees[node] == 1)
+        {
+            degreeOneNodes.push_back(node);
+        }
+    }
+
+    matching = Matching(nodeCount);
+    int nextNode = 0; // Nodes before it are matched or have no free neighbor left
+    while (true)
+    {
+        // A free node with a single free neighbor can be matched to it without losing a maximum matching
+        int node = -1;
+        while (!degreeOneNodes.empty() && node == -1)
+        {
+            int candidate = degreeOneNodes.back();
+            degreeOneNodes.pop_back();
+            if (mates[candidate] == -1 && degrees[candidate] == 1)
+            {
+                node = candidate;
+            }
+        }
+
+        // Otherwise fall back to the first free node that still has a free neighbor
+        if (node == -1)
+        {
+            while (nextNode < nodeCount && (mates[nextNode] != -1 || degrees[nextNode] == 0))
+            {
+                nextNode++;
+            }
+            if (nextNode == nodeCount)
+            {
+                break;
+            }
+            node = nextNode;
+        }
+
+        // Match the node to its first free neighbor, which exists because its degree is positive
+        int entry = offsets[node];
+        while (mates[adjacentNodes[entry]] != -1)
+        {
+            entry++;
+        }
+        int mate = adjacentNodes[entry];
+        mates[node] = mate;
+        mates[mate] = node;
+        if (node < nodeCount / 2)
+        {
+            matching.addPair(node + 1, mate + 1, adjacentEdges[entry]);
+        }
+        else
+        {
+            matching.addPair(mate + 1, node + 1, adjacentEdges[entry]);
+        }
+
+        // Both nodes leave the graph, so their free neighbors lose an edge each
+        for (int matchedNode : {node, mate})
+        {
+            for (int neighborEntry = offsets[matchedNode]; neighborEntry < offsets[matchedNode + 1]; neighborEntry++)
+            {
+                int neighbor = adjacentNodes[neighborEntry];
+                if (mates[neighbor] == -1 && --degrees[neighbor] == 1)
+                {
+                    degreeOneNodes.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    return matching.size();
+}
+
+/*
+ * @brief Lay out the edges from the left set to the right set as a compressed adjacency array of both sets.
+ * @param graph The graph.
+ * @param nodeCount The number of nodes in the graph, without a source or a sink.
+ * @param offsets Receives the first adjacency entry of each node, renumbered from 0, followed by the number of entries.
+ * @param adjacentNodes Receives the neighbor of each adjacency entry.
+ * @param adjacentEdges Receives the index in Graph::getEdges() of the edge of each adjacency entry.
+ * @pre None.
+ * @post Every edge from the left set to the right set appears once at each of its nodes; other edges are left out.
+ */
+void MatchingInitializer::buildAdjacency(const Graph &graph, int nodeCount, vector<int> &offsets, vector<int> &adjacentNodes,
+                                         vector<int> &adjacentEdges)
+{
+    // The engines report edges that do not lead from the left set to the right set; here they are only skipped
+    const vector<Edge> &edges = graph.getEdges();
+    int leftCount = nodeCount / 2;
+    offsets.assign(nodeCount + 1, 0);
+    for (const Edge &edge : edges)
+    {
+        int left = edge.getSourceIndex() - 1;
+        int right = edge.getDestinationIndex() - 1;
+        if (left >= 0 && left < leftCount && right >= leftCount && right < nodeCount)
+        {
+            offsets[left + 1]++;
+            offsets[right + 1]++;
+        }
+    }
+    for (int node = 0; node < nodeCount; node++)
+    {
+        offsets[node + 1] += offsets[node];
+    }
+
+    vector<int> nextEntry(offsets.begin(), offsets.end() - 1);
+    adjacentNodes.assign(offsets[nodeCount], 0);
+    adjacentEdges.assign(offsets[nodeCount], 0);
+    for (int i = 0; i < static_cast<int>(edges.size()); i++)
+    {
+        int left = edges[i].getSourceIndex() - 1;
+        int right = edges[i].getDestinationIndex() - 1;
+        if (left >= 0 && left < leftCount && right >= leftCount && right < nodeCount)
+        {
+            adjacentNodes[nextEntry[left]] = right;
+            adjacentEdges[nextEntry[left]++] = i;
+            adjacentNodes[nextEntry[right]] = left;
+            adjacentEdges[nextEntry[right]++] = i;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * @file MatchingInitializer.h
+ * @brief Declaration of the MatchingInitializer class, which finds a large matching quickly for an engine to start from.
+ *
+ * This file defines the MatchingInitializer class. Its heuristics run in linear time and return a matching that is
+ * usually close to maximum, so the maximum matching engines only have to find the few long augmenting paths that are
+ * left instead of spending their first phases on trivial ones. The greedy pass matches each left node to its first
+ * free neighbor. The Karp-Sipser heuristic first matches every node that has a single free neighbor left, which
+ * never loses a maximum matching, and only falls back to a greedy choice when no such node exists.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+#include "Graph.h"
+#include "Matching.h"
+
+/*
+ * @brief Class providing heuristics that find an initial matching for the maximum matching engines.
+ */
+class MatchingInitializer
+{
+public:
+    /*
+     * @brief Match each left node to its first free neighbor.
+     * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose edges lead from the left set to the right set.
+     * @param nodeCount The number of nodes in the graph, without a source or a sink.
+     * @param matching Receives the matching, over the nodes 1 to nodeCount.
+     * @return The number of matched pairs.
+     * @pre nodeCount is even.
+     * @post The matching is maximal: no edge joins two free nodes.
+     */
+    static int findGreedyMatching(const Graph &graph, int nodeCount, Matching &matching);
+
+    /*
+     * @brief Match nodes with a single free neighbor first, and otherwise the first free node with its first free neighbor.
+     * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose edges lead from the left set to the right set.
+     * @param nodeCount The number of nodes in the graph, without a source or a sink.
+     * @param matching Receives the matching, over the nodes 1 to nodeCount.
+     * @return The number of matched pairs.
+     * @pre nodeCount is even.
+     * @post The matching is maximal: no edge joins two free nodes.
+     */
+    static int findKarpSipserMatching(const Graph &graph, int nodeCount, Matching &matching);
+
+private:
+    /*
+     * @brief Lay out the edges from the left set to the right set as a compressed adjacency array of both sets.
+     * @param graph The graph.
+     * @param nodeCount The number of nodes in the graph, without a source or a sink.
+     * @param offsets Receives the first adjacency entry of each node, renumbered from 0, followed by the number of entries.
+     * @param adjacentNodes Receives the neighbor of each adjacency entry.
+     * @param adjacentEdges Receives the index in Graph::getEdges() of the edge of each adjacency entry.
+     * @pre None.
+     * @post Every edge from the left set to the right set appears once at each of its nodes; other edges are left out.
+     */
+    static void buildAdjacency(const Graph &graph, int nodeCount, std::vector<int> &offsets, std::vector<int> &adjacentNodes,
+                               std::vector<int> &adjacentEdges);
+};
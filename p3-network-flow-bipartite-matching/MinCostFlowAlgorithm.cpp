@@ -0,0 +1,203 @@
+/*
+ * @file MinCostFlowAlgorithm.cpp
+ * @brief Implementation of the MinCostFlowAlgorithm class functions.
+ *
+ * This file contains the implementation of the functions declared in the MinCostFlowAlgorithm class. When every
+ * cost is non-negative the potentials start at 0; otherwise one Bellman-Ford pass sets them. After each Dijkstra
+ * search the potential of every reached node grows by its distance, which keeps the reduced costs of all residual
+ * arcs non-negative, including the reverse arcs of the path that was just augmented.
+ *
+ * @author Phat Tran
+ */
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <utility>
+#include "MinCostFlowAlgorithm.h"
+
+using namespace std;
+
+/*
+ * @brief Find a maximum flow of minimum cost from a source to a sink.
+ * @param network The residual network, which must not carry flow yet; arc costs may be negative.
+ * @param source The index of the source node.
+ * @param sink The index of the sink node.
+ * @param totalCost Receives the total cost of the flow.
+ * @return The value of the flow, or -1 if the network has a cycle of negative cost.
+ * @pre The network is built, and source and sink are distinct nodes of it.
+ * @post The network carries a maximum flow whose cost is the least among all maximum flows.
+ */
+long long MinCostFlowAlgorithm::findMinCostMaxFlow(ResidualNetwork &network, int source, int sink, long long &totalCost)
+{
+    int nodeCount = network.getNodeCount();
+    vector<long long> potentials(nodeCount, 0), distances(nodeCount);
+    vector<int> parentArcs(nodeCount, -1);
+    totalCost = 0;
+
+    if (!initializePotentials(network, source, potentials))
+    {
+        cerr << "Error: The network has a cycle of negative cost." << endl;
+        return -1;
+    }
+
+    long long totalFlow = 0;
+    while (true)
+    {
+        findShortestPaths(network, source, potentials, distances, parentArcs);
+        if (distances[sink] == -1)
+        {
+            break;
+        }
+
+        // Keep the reduced costs non-negative for the next search
+        for (int node = 0; node < nodeCount; node++)
+        {
+            if (distances[node] != -1)
+            {
+                potentials[node] += distances[node];
+            }
+        }
+
+        // Augment by the bottleneck of the cheapest path
+        int bottleneck = numeric_limits<int>::max();
+        for (int node = sink; node != source; node = network.getHead(network.getReverseArc(parentArcs[node])))
+        {
+            bottleneck = min(bottleneck, network.getCapacity(parentArcs[node]));
+        }
+        for (int node = sink; node != source; node = network.getHead(network.getReverseArc(parentArcs[node])))
+        {
+            network.pushFlow(parentArcs[node], bottleneck);
+            totalCost += static_cast<long long>(bottleneck) * network.getCost(parentArcs[node]);
+        }
+        totalFlow += bottleneck;
+    }
+
+    return totalFlow;
+}
+
+/*
+ * @brief Compute initial potentials as shortest path distances from the source with the Bellman-Ford algorithm.
+ * @param network The residual network.
+ * @param source The index of the source node.
+ * @param potentials Receives the distance of each node, or 0 for nodes the source cannot reach.
+ * @return True if the potentials are valid, false if a cycle of negative cost is reachable.
+ * @pre None.
+ * @post Every residual arc has a non-negative reduced cost.
+ */
+bool MinCostFlowAlgorithm::initializePotentials(const ResidualNetwork &network, int source, vector<long long> &potentials)
+{
+    int nodeCount = network.getNodeCount();
+    fill(potentials.begin(), potentials.end(), 0);
+
+    // Zero potentials already work when no residual arc has a negative cost
+    bool hasNegativeCost = false;
+    for (int node = 0; node < nodeCount && !hasNegativeCost; node++)
+    {
+        for (int arc = network.getArcBegin(node); arc < network.getArcEnd(node); arc++)
+        {
+            if (network.getCapacity(arc) > 0 && network.getCost(arc) < 0)
+            {
+                hasNegativeCost = true;
+                break;
+            }
+        }
+    }
+    if (!hasNegativeCost)
+    {
+        return true;
+    }
+
+    // Relax every residual arc until nothing changes; a change in round nodeCount means a negative cycle
+    const long long UNREACHED = numeric_limits<long long>::max();
+    vector<long long> distances(nodeCount, UNREACHED);
+    distances[source] = 0;
+    for (int round = 0; round < nodeCount; round++)
+    {
+        bool changed = false;
+        for (int node = 0; node < nodeCount; node++)
+        {
+            if (distances[node] == UNREACHED)
+            {
+                continue;
+            }
+            for (int arc = network.getArcBegin(node); arc < network.getArcEnd(node); arc++)
+            {
+                int head = network.getHead(arc);
+                if (network.getCapacity(arc) > 0 && distances[node] + network.getCost(arc) < distances[head])
+                {
+                    distances[head] = distances[node] + network.getCost(arc);
+                    changed = true;
+                }
+            }
+        }
+        if (!changed)
+        {
+            break;
+        }
+        if (round == nodeCount - 1)
+        {
+            return false;
+        }
+    }
+
+    // Nodes the source cannot reach never lie on an augmenting path
+    for (int node = 0; node < nodeCount; node++)
+    {
+        potentials[node] = (distances[node] == UNREACHED) ? 0 : distances[node];
+    }
+    return true;
+}
+
+/*
+ * @brief Find the cheapest path from the source to every node by reduced costs with Dijkstra's algorithm.
+ * @param network The residual network.
+ * @param source The index of the source node.
+ * @param potentials The node potentials, which make every reduced cost non-negative.
+ * @param distances Receives the reduced distance of each node, or -1 if it is unreachable.
+ * @param parentArcs Receives the arc each reached node was entered through on its cheapest path.
+ * @pre distances and parentArcs hold one entry per node.
+ * @post The distances and the shortest path tree are set.
+ */
+void MinCostFlowAlgorithm::findShortestPaths(const ResidualNetwork &network, int source, const vector<long long> &potentials,
+                                             vector<long long> &distances, vector<int> &parentArcs)
+{
+    fill(distances.begin(), distances.end(), -1);
+    vector<bool> settled(distances.size(), false);
+
+    // Queue entries are (distance, node); stale entries are skipped when popped
+    priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<pair<long long, int>>> nodeQueue;
+    distances[source] = 0;
+    nodeQueue.push(make_pair(0LL, source));
+
+    while (!nodeQueue.empty())
+    {
+        int node = nodeQueue.top().second;
+        nodeQueue.pop();
+        if (settled[node])
+        {
+            continue;
+        }
+        settled[node] = true;
+
+        for (int arc = network.getArcBegin(node); arc < network.getArcEnd(node); arc++)
+        {
+            int head = network.getHead(arc);
+            if (network.getCapacity(arc) == 0 || settled[head])
+            {
+                continue;
+            }
+
+            long long reducedCost = network.getCost(arc) + potentials[node] - potentials[head];
+            long long distance = distances[node] + reducedCost;
+            if (distances[head] == -1 || distance < distances[head])
+            {
+                distances[head] = distance;
+                parentArcs[head] = arc;
+                nodeQueue.push(make_pair(distance, head));
+            }
+        }
+    }
+}
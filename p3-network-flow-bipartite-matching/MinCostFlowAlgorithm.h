@@ -0,0 +1,61 @@
+/*
+ * @file MinCostFlowAlgorithm.h
+ * @brief Declaration of the MinCostFlowAlgorithm class, successive shortest paths for minimum cost maximum flow.
+ *
+ * This file defines the MinCostFlowAlgorithm class. It repeatedly augments along a cheapest path from the source to
+ * the sink in the residual network. Each node carries a potential, and arc costs are measured relative to the
+ * potentials of their ends (Johnson's reweighting), which keeps every residual cost non-negative so that Dijkstra's
+ * algorithm finds each cheapest path. On a bipartite matching network this solves the weighted assignment problem:
+ * among the matchings of maximum size, it finds one of minimum total weight.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+#include "ResidualNetwork.h"
+
+/*
+ * @brief Class providing the successive shortest path minimum cost flow algorithm.
+ */
+class MinCostFlowAlgorithm
+{
+public:
+    /*
+     * @brief Find a maximum flow of minimum cost from a source to a sink.
+     * @param network The residual network, which must not carry flow yet; arc costs may be negative.
+     * @param source The index of the source node.
+     * @param sink The index of the sink node.
+     * @param totalCost Receives the total cost of the flow.
+     * @return The value of the flow, or -1 if the network has a cycle of negative cost.
+     * @pre The network is built, and source and sink are distinct nodes of it.
+     * @post The network carries a maximum flow whose cost is the least among all maximum flows.
+     */
+    static long long findMinCostMaxFlow(ResidualNetwork &network, int source, int sink, long long &totalCost);
+
+private:
+    /*
+     * @brief Compute initial potentials as shortest path distances from the source with the Bellman-Ford algorithm.
+     * @param network The residual network.
+     * @param source The index of the source node.
+     * @param potentials Receives the distance of each node, or 0 for nodes the source cannot reach.
+     * @return True if the potentials are valid, false if a cycle of negative cost is reachable.
+     * @pre None.
+     * @post Every residual arc has a non-negative reduced cost.
+     */
+    static bool initializePotentials(const ResidualNetwork &network, int source, std::vector<long long> &potentials);
+
+    /*
+     * @brief Find the cheapest path from the source to every node by reduced costs with Dijkstra's algorithm.
+     * @param network The residual network.
+     * @param source The index of the source node.
+     * @param potentials The node potentials, which make every reduced cost non-negative.
+     * @param distances Receives the reduced distance of each node, or -1 if it is unreachable.
+     * @param parentArcs Receives the arc each reached node was entered through on its cheapest path.
+     * @pre distances and parentArcs hold one entry per node.
+     * @post The distances and the shortest path tree are set.
+     */
+    static void findShortestPaths(const ResidualNetwork &network, int source, const std::vector<long long> &potentials,
+                                  std::vector<long long> &distances, std::vector<int> &parentArcs);
+};
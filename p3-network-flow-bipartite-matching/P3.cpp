@@ -3,154 +3,183 @@
  * @brief Implementation of the Ford-Fulkerson algorithm for bipartite matching using the shortest augmenting paths method.
  *
  * This file reads data from an input file ("program3data.txt"), constructs a bipartite graph, and executes the Ford-Fulkerson
- * algorithm using the shortest augmenting paths method to find matches in the bipartite graph. It then prints the matches and
- * the total number of matches.
+ * algorithm using the shortest augmenting paths method to find matches in the bipartite graph. The shortest augmenting paths
+ * are found a level graph at a time by Dinic's algorithm. It then prints the matches and the total number of matches. An
+ * input that also names a source and a sink is solved as a general maximum flow problem on the edge capacities instead.
  *
  * @author Phat Tran
  */
 
 #include <iostream>
-#include <fstream>
-#include <vector>
-#include "Node.h"
+#include <string>
 #include "Graph.h"
+#include "GraphIO.h"
+#include "Matching.h"
+#include "MatchingInitializer.h"
+#include "DinicAlgorithm.h"
+#include "HopcroftKarpAlgorithm.h"
+#include "PothenFanAlgorithm.h"
+#include "PushRelabelAlgorithm.h"
+#include "MinCostFlowAlgorithm.h"
+#include "HungarianAlgorithm.h"
 
 using namespace std;
 
 /*
  * @brief Main function for the Ford-Fulkerson algorithm with shortest augmenting paths for bipartite matching.
  *
- * @pre The input file "program3data.txt" exists and contains valid data for constructing a bipartite graph.
+ * @pre The input file ("program3data.txt" by default) exists and contains valid data for constructing a graph.
  *      The file format adheres to the specified structure, providing the number of nodes, node names, number
- *       of edges, and edge connections between nodes.
+ *      of edges, and edge connections between nodes, each optionally with a capacity. A flow input ends with
+ *      the indices of the source and the sink.
  *
- * @post The matches in the bipartite graph and the total number of matches are printed to the console.
- *       The graph object is properly constructed, and the necessary network flow operations are performed.
+ * @post For a bipartite input, the matches and the total number of matches are printed to the console. For a
+ *       flow input, the flow on each edge and the value of the maximum flow are printed instead.
  *
- * @usage This function is called to execute the Ford-Fulkerson algorithm with the shortest augmenting paths
- *        method for bipartite matching.
+ * @usage P3 [dinic|hopcroft-karp|pothen-fan|push-relabel|min-cost|hungarian] [inputFile] [none|karp-sipser|greedy]
+ *        The optional first argument selects the engine: Dinic's algorithm on the flow network (the default),
+ *        Hopcroft-Karp directly on the bipartite graph, multithreaded Pothen-Fan directly on the bipartite graph,
+ *        FIFO push-relabel on the flow network, successive shortest paths for a maximum flow or matching of minimum
+ *        cost, or the Hungarian algorithm for a minimum weight assignment. Hopcroft-Karp, Pothen-Fan and Hungarian
+ *        only handle bipartite matching inputs. The optional third argument selects the initial matching that
+ *        Dinic, Hopcroft-Karp, Pothen-Fan and push-relabel start from on a bipartite input: the Karp-Sipser
+ *        heuristic, a greedy pass, or none (the default).
  *
- * @return 0 on successful execution.
+ * @param argc The number of command-line arguments.
+ * @param argv The command-line arguments.
+ * @return 0 on successful execution, 1 if the input cannot be read or the engine does not apply.
  */
-int main()
+int main(int argc, char *argv[])
 {
-    // Read data from the file
-    const string inputFileName = "program3data.txt";
-    ifstream inputFile(inputFileName);
-
-    // Check if the file was opened successfully
-    if (!inputFile.is_open())
+    // Select the engine and the input file
+    const string engine = (argc > 1) ? argv[1] : "dinic";
+    const string inputFileName = (argc > 2) ? argv[2] : "program3data.txt";
+    const string initializer = (argc > 3) ? argv[3] : "none";
+    if (argc > 4 || (engine != "dinic" && engine != "hopcroft-karp" && engine != "pothen-fan" && engine != "push-relabel" && engine != "min-cost" && engine != "hungarian") ||
+        (initializer != "karp-sipser" && initializer != "greedy" && initializer != "none"))
     {
-        cerr << "Error: Cannot open program3data.txt file." << endl;
+        cerr << "Usage: " << argv[0] << " [dinic|hopcroft-karp|pothen-fan|push-relabel|min-cost|hungarian] [inputFile] [none|karp-sipser|greedy]" << endl;
         return 1;
     }
 
+    // Read data from the file
     Graph graph; // Instance of the Graph class
-
-    // Load the nodes from the input file
-    int nodeCount;
-    inputFile >> nodeCount;
-
-    for (int i = 0; i < nodeCount; i++)
+    int source, sink;
+    if (!GraphIO::loadGraph(inputFileName, graph, source, sink))
     {
-        // Read the name of the node from the input file
-        string nodeName;
-        inputFile >> nodeName;
-
-        // Create a new node with the read information and add it to the graph
-        Node newNode(nodeName, i + 1, 0);
-        graph.addNode(newNode);
+        return 1;
     }
+    int nodeCount = static_cast<int>(graph.getNodes().size());
 
-    // Load the edges from the input file
-    int edgeCount;
-    inputFile >> edgeCount;
-
-    for (int i = 0; i < edgeCount; i++)
+    // Only the maximum matching engines start from an initial matching; the weighted engines would lose optimality
+    const bool weighted = (engine == "min-cost" || engine == "hungarian");
+    if (initializer != "none" && (source != -1 || weighted))
     {
-        // Read the source and destination indices (1-based indexing)
-        int sourceIndex, destinationIndex;
-        inputFile >> sourceIndex >> destinationIndex;
-
-        // Convert to 0-based indexing
-        sourceIndex--;
-        destinationIndex--;
-
-        // Add an edge to the graph with no flow initially (false)
-        graph.addEdge(graph.getNode(sourceIndex).getIndex(), graph.getNode(destinationIndex).getIndex(), false);
+        cerr << "Error: only dinic, hopcroft-karp, pothen-fan and push-relabel on a matching input start from an initial matching; use none or leave out the initializer." << endl;
+        return 1;
     }
 
-    inputFile.close();
-
-    // Construct the residual graph
-    graph.createResidualGraph();
-
-    while (true)
+    // A flow input names its source and sink; find a maximum flow between them
+    if (source != -1)
     {
-        // Build the level graph and check if there is a path from source to sink
-        bool pathExists = graph.createLevelGraph();
-
-        // If there is no path from source to sink, the algorithm has finished executing
-        if (!pathExists)
+        if (engine == "hopcroft-karp" || engine == "pothen-fan" || engine == "hungarian")
         {
-            break;
+            cerr << "Error: " << engine << " only finds bipartite matchings; use dinic, push-relabel or min-cost for a flow input." << endl;
+            return 1;
         }
 
-        // Start at the source node
-        int currentNode = graph.getNode(0).getIndex();
-        vector<int> currentPath;
-
-        // Continue the loop while there are still reachable nodes in the level graph from the source
-        while (!graph.getLevelGraphAt(0).empty())
+        graph.createFlowNetwork();
+        if (engine == "min-cost")
         {
-            // If the current node is the sink
-            if (currentNode == nodeCount + 1)
+            // Among the maximum flows, find one of least total cost
+            long long totalCost;
+            long long flowValue = MinCostFlowAlgorithm::findMinCostMaxFlow(graph.getResidualNetwork(), source, sink, totalCost);
+            if (flowValue == -1)
             {
-                currentPath.push_back(currentNode);     // Add the current node to the path
-                graph.augmentFlow(currentPath);         // Increase the flow along the path
-                graph.updateResidualGraph(currentPath); // Update the residual graph
-                graph.updateLevelGraph(currentPath);    // Remove the used edges from the level graph
-                currentNode = 0;                        // Return to the source
-                currentPath.clear();                    // Clear the path
-            }
-            else
-            {
-                // If the current node has no outgoing edges in the level graph, retreat (go back)
-                if (graph.getLevelGraphAt(currentNode).empty())
-                {
-                    graph.removeNodeAndIncomingEdges(currentNode); // Remove the current node and its incoming edges
-                    currentNode = currentPath.back();              // Update the current node to the previous node in the current path
-                    currentPath.pop_back();                        // Remove the last node from the current path
-                }
-                else
-                {
-                    // Otherwise, move to the next node in the level graph
-                    vector<int>::const_iterator it = graph.getLevelGraphAt(currentNode).begin();
-                    currentPath.push_back(currentNode); // Add the current node to the path
-                    currentNode = *it;                  // Move to the next node
-                }
+                return 1;
             }
+            GraphIO::printFlow(graph, flowValue);
+            GraphIO::printCost(totalCost);
+            return 0;
         }
+
+        long long flowValue = (engine == "push-relabel") ? PushRelabelAlgorithm::findMaxFlow(graph.getResidualNetwork(), source, sink)
+                                                         : DinicAlgorithm::findMaxFlow(graph.getResidualNetwork(), source, sink);
+        GraphIO::printFlow(graph, flowValue);
+        return 0;
     }
 
-    // Print the matches
-    int matchCount = 0;
-    for (const Edge &edge : graph.getEdges())
+    // The Hungarian engine holds a dense cost matrix of the left set by the right set, whatever the number of edges
+    if (engine == "hungarian" && nodeCount / 2 > HungarianAlgorithm::MAX_SIDE)
     {
-        // Check if the edge has flow, indicating a matched pair
-        if (edge.hasFlow())
+        cerr << "Error: hungarian needs a dense " << nodeCount / 2 << " x " << nodeCount / 2 << " cost matrix, but handles at most "
+             << HungarianAlgorithm::MAX_SIDE << " nodes per side; use min-cost for large sparse inputs." << endl;
+        return 1;
+    }
+
+    // Find most of the matching in linear time, so the engine only has to find the remaining augmenting paths
+    Matching matching; // The matching found by the selected engine
+    if (!weighted && initializer == "karp-sipser")
+    {
+        MatchingInitializer::findKarpSipserMatching(graph, nodeCount, matching);
+    }
+    else if (!weighted && initializer == "greedy")
+    {
+        MatchingInitializer::findGreedyMatching(graph, nodeCount, matching);
+    }
+
+    if (engine == "hopcroft-karp")
+    {
+        // Match the left set to the right set directly, without a source or a sink
+        HopcroftKarpAlgorithm::findMaximumMatching(graph, nodeCount, matching);
+    }
+    else if (engine == "pothen-fan")
+    {
+        // Search from all free left nodes at once on every hardware thread
+        PothenFanAlgorithm::findMaximumMatching(graph, nodeCount, matching);
+    }
+    else if (engine == "hungarian")
+    {
+        // Assign on the dense cost matrix of the left set by the right set
+        long long totalCost = HungarianAlgorithm::findMinCostAssignment(graph, nodeCount, matching);
+        GraphIO::printMatching(graph, matching);
+        GraphIO::printCost(totalCost);
+        return 0;
+    }
+    else if (engine == "min-cost")
+    {
+        // Find a maximum matching of least total weight as a minimum cost flow
+        graph.createResidualGraph();
+        long long totalCost;
+        if (MinCostFlowAlgorithm::findMinCostMaxFlow(graph.getResidualNetwork(), 0, nodeCount + 1, totalCost) == -1)
         {
-            const Node &sourceNode = graph.getNode(edge.getSourceIndex());
-            const Node &destinationNode = graph.getNode(edge.getDestinationIndex());
+            return 1;
+        }
+        matching = graph.createMatching();
+        GraphIO::printMatching(graph, matching);
+        GraphIO::printCost(totalCost);
+        return 0;
+    }
+    else
+    {
+        // Construct the residual graph, carrying the flow of the initial matching
+        graph.createResidualGraph();
+        graph.applyMatching(matching);
 
-            // Output the matched pair of nodes
-            cout << sourceNode.getName() << " / " << destinationNode.getName() << endl;
-            matchCount++;
+        // Find a maximum flow from the source to the sink; each unit of flow crosses one matched edge
+        int sinkIndex = nodeCount + 1;
+        if (engine == "push-relabel")
+        {
+            PushRelabelAlgorithm::findMaxFlow(graph.getResidualNetwork(), 0, sinkIndex);
+        }
+        else
+        {
+            DinicAlgorithm::findMaxFlow(graph.getResidualNetwork(), 0, sinkIndex);
         }
+        matching = graph.createMatching();
     }
 
-    // Output the total number of matches
-    cout << matchCount << " total matches" << endl;
+    GraphIO::printMatching(graph, matching);
 
     return 0;
 }
@@ -0,0 +1,326 @@
+/*
+ * @file ParallelBFSAlgorithm.cpp
+ * @brief Implementation of the ParallelBFSAlgorithm class functions.
+ *
+ * This file contains the implementation of the functions declared in the ParallelBFSAlgorithm class. Every thread
+ * runs the same loop over the levels and meets the others at a barrier after each step, and thread 0 merges the
+ * next frontiers between two barriers. A node is claimed top-down by the thread whose atomic fetch_or sets its
+ * visited bit first. Bottom-up, each thread owns whole 64-bit words of the bitmaps, so no node can be claimed twice.
+ * The frontier bitmap is only filled while the search runs bottom-up and is cleared again after each such level.
+ *
+ * @author Phat Tran
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "ParallelBFSAlgorithm.h"
+#include "ParallelUtils.h"
+
+using namespace std;
+
+/*
+ * @brief The frontiers, bitmaps and counters shared by the threads of one search.
+ */
+struct ParallelBFSAlgorithm::SearchState
+{
+    SearchState(const ResidualNetwork &network, int sink, vector<int> &levels, int threadCount)
+        : network(network), sink(sink), levels(levels), threadCount(threadCount),
+          visited((network.getNodeCount() + 63) / 64), frontierBits((network.getNodeCount() + 63) / 64),
+          nextFrontiers(threadCount), nextArcCounts(threadCount, 0), scannedArcCounts(threadCount, 0) {}
+
+    const ResidualNetwork &network;         // The residual network being searched.
+    int sink;                               // Index of the sink node.
+    vector<int> &levels;                    // Distance of each node from the source, or -1.
+    int threadCount;                        // Number of threads running the search.
+    vector<atomic<uint64_t>> visited;       // One bit per node, set once the node is labeled.
+    vector<atomic<uint64_t>> frontierBits;  // One bit per node of the frontier, while the search runs bottom-up.
+    vector<int> frontier;                   // Nodes of the current level.
+    vector<vector<int>> nextFrontiers;      // Nodes of the next level, per thread.
+    vector<long long> nextArcCounts;        // Arcs leaving the nodes claimed bottom-up, per thread.
+    vector<long long> scannedArcCounts;     // Arcs scanned by the current bottom-up level, per thread.
+    long long frontierArcs = 0;             // Arcs leaving the frontier, estimated after a top-down level.
+    long long unexploredArcs = 0;           // Arcs leaving the nodes not labeled yet, estimated.
+    long long bottomUpArcs = -1;            // Arcs scanned by the last bottom-up level, or -1 before the first one.
+    int depth = 0;                          // Level of the frontier.
+    bool bottomUp = false;                  // Whether the current level is expanded bottom-up.
+    bool done = false;                      // Whether the search is finished.
+    atomic<int> arrivedThreads{0};          // Threads waiting at the barrier.
+    atomic<int> barrierGeneration{0};       // Number of times the barrier has opened.
+};
+
+/*
+ * @brief Label every node with its BFS distance from the source over arcs with residual capacity.
+ * @param network The residual network.
+ * @param source The index of the source node.
+ * @param sink The index of the sink node.
+ * @param levels Receives the distance of each node, or -1 for nodes the search did not reach.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @return True if the sink was reached, false otherwise.
+ * @pre The network is built, and levels holds one entry per node.
+ * @post The levels are set; the search stops after the level of the sink, so nodes farther away are left unreached.
+ */
+bool ParallelBFSAlgorithm::buildLevels(const ResidualNetwork &network, int source, int sink, vector<int> &levels, int threadCount)
+{
+    // Small networks are not worth the barriers; give every thread a sizable range of nodes
+    const int NODES_PER_THREAD = 1 << 16;
+    int nodeCount = network.getNodeCount();
+    SearchState state(network, sink, levels, ParallelUtils::resolveThreadCount(threadCount, nodeCount / NODES_PER_THREAD));
+
+    // The source alone forms the first frontier
+    fill(levels.begin(), levels.end(), -1);
+    levels[source] = 0;
+    state.visited[source / 64].store(uint64_t(1) << (source % 64), memory_order_relaxed);
+    state.frontier.push_back(source);
+    state.frontierArcs = network.getArcEnd(source) - network.getArcBegin(source);
+    state.unexploredArcs = 2LL * network.getEdgeCount() - state.frontierArcs;
+    state.done = (source == sink);
+
+    // The calling thread takes part as thread 0
+    vector<thread> workers;
+    for (int worker = 1; worker < state.threadCount; worker++)
+    {
+        workers.push_back(thread(searchLevels, ref(state), worker));
+    }
+    searchLevels(state, 0);
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    return levels[sink] != -1;
+}
+
+/*
+ * @brief Run the levels of the search on one thread.
+ * @param state The shared state of the search.
+ * @param thread The index of the thread, from 0 to the number of threads - 1.
+ * @pre The source is labeled and forms the frontier.
+ * @post The search is finished.
+ */
+void ParallelBFSAlgorithm::searchLevels(SearchState &state, int thread)
+{
+    while (!state.done)
+    {
+        // This thread's share of the frontier
+        size_t frontierSize = state.frontier.size();
+        size_t begin = frontierSize * thread / state.threadCount;
+        size_t end = frontierSize * (thread + 1) / state.threadCount;
+
+        if (state.bottomUp)
+        {
+            // Mark the frontier, search from the unvisited side, then clear the marks for the next level
+            for (size_t i = begin; i < end; i++)
+            {
+                int node = state.frontier[i];
+                state.frontierBits[node / 64].fetch_or(uint64_t(1) << (node % 64), memory_order_relaxed);
+            }
+            waitForThreads(state);
+            expandBottomUp(state, thread);
+            waitForThreads(state);
+            for (size_t i = begin; i < end; i++)
+            {
+                state.frontierBits[state.frontier[i] / 64].store(0, memory_order_relaxed);
+            }
+        }
+        else
+        {
+            expandTopDown(state, thread);
+        }
+
+        waitForThreads(state);
+        if (thread == 0)
+        {
+            advanceFrontier(state);
+        }
+        waitForThreads(state);
+    }
+}
+
+/*
+ * @brief Expand the share of the frontier of one thread along the arcs that leave it.
+ * @param state The shared state of the search.
+ * @param thread The index of the thread.
+ * @pre The frontier holds the nodes of the current level.
+ * @post Every node reached from the share is labeled and placed in the next frontier of the thread that claimed it.
+ */
+void ParallelBFSAlgorithm::expandTopDown(SearchState &state, int thread)
+{
+    const ResidualNetwork &network = state.network;
+    vector<int> &levels = state.levels;
+    vector<int> &nextFrontier = state.nextFrontiers[thread];
+    const int nextLevel = state.depth + 1;
+    const bool shared = state.threadCount > 1;
+    size_t frontierSize = state.frontier.size();
+    size_t begin = frontierSize * thread / state.threadCount;
+    size_t end = frontierSize * (thread + 1) / state.threadCount;
+
+    for (size_t i = begin; i < end; i++)
+    {
+        int node = state.frontier[i];
+        for (int arc = network.getArcBegin(node); arc < network.getArcEnd(node); arc++)
+        {
+            if (network.getCapacity(arc) == 0)
+            {
+                continue;
+            }
+
+            // Read the bit first so that visited nodes cost no atomic write; a lone thread needs no atomic write at all
+            unsigned head = static_cast<unsigned>(network.getHead(arc));
+            atomic<uint64_t> &word = state.visited[head / 64];
+            uint64_t bit = uint64_t(1) << (head % 64);
+            uint64_t visitedWord = word.load(memory_order_relaxed);
+            if ((visitedWord & bit) != 0)
+            {
+                continue;
+            }
+            if (!shared)
+            {
+                word.store(visitedWord | bit, memory_order_relaxed);
+            }
+            else if ((word.fetch_or(bit, memory_order_relaxed) & bit) != 0)
+            {
+                continue; // Another thread claimed the node first
+            }
+            levels[head] = nextLevel;
+            nextFrontier.push_back(static_cast<int>(head));
+        }
+    }
+}
+
+/*
+ * @brief Look for a parent in the frontier for every unvisited node in the range of one thread.
+ * @param state The shared state of the search.
+ * @param thread The index of the thread.
+ * @pre The frontier bitmap marks the nodes of the current level.
+ * @post Every node of the range with a residual arc from the frontier is labeled and placed in the next frontier of the thread.
+ */
+void ParallelBFSAlgorithm::expandBottomUp(SearchState &state, int thread)
+{
+    const ResidualNetwork &network = state.network;
+    vector<int> &levels = state.levels;
+    vector<int> &nextFrontier = state.nextFrontiers[thread];
+    const int nextLevel = state.depth + 1;
+    int nodeCount = network.getNodeCount();
+    size_t wordCount = state.visited.size();
+    size_t beginWord = wordCount * thread / state.threadCount;
+    size_t endWord = wordCount * (thread + 1) / state.threadCount;
+    long long nextArcCount = 0;
+    long long scannedArcCount = 0;
+
+    for (size_t wordIndex = beginWord; wordIndex < endWord; wordIndex++)
+    {
+        uint64_t visitedWord = state.visited[wordIndex].load(memory_order_relaxed);
+        uint64_t claimedBits = 0;
+        for (int node = static_cast<int>(wordIndex * 64); node < nodeCount && node < static_cast<int>(wordIndex * 64 + 64); node++)
+        {
+            uint64_t bit = uint64_t(1) << (node % 64);
+            if (visitedWord & bit)
+            {
+                continue;
+            }
+
+            // A residual arc into the node from the frontier is the reverse of one of the node's own arcs
+            for (int arc = network.getArcBegin(node); arc < network.getArcEnd(node); arc++)
+            {
+                scannedArcCount++;
+                int parent = network.getHead(arc);
+                if ((state.frontierBits[parent / 64].load(memory_order_relaxed) & (uint64_t(1) << (parent % 64))) != 0 &&
+                    network.getCapacity(network.getReverseArc(arc)) > 0)
+                {
+                    claimedBits |= bit;
+                    levels[node] = nextLevel;
+                    nextFrontier.push_back(node);
+                    nextArcCount += network.getArcEnd(node) - network.getArcBegin(node);
+                    break;
+                }
+            }
+        }
+
+        // The word belongs to this thread alone while the search runs bottom-up
+        if (claimedBits != 0)
+        {
+            state.visited[wordIndex].store(visitedWord | claimedBits, memory_order_relaxed);
+        }
+    }
+
+    state.nextArcCounts[thread] = nextArcCount;
+    state.scannedArcCounts[thread] = scannedArcCount;
+}
+
+/*
+ * @brief Merge the next frontiers of all threads and choose the direction of the next level.
+ * @param state The shared state of the search.
+ * @pre Every thread has finished expanding the current level.
+ * @post The frontier holds the nodes of the next level, and the search is marked done if it is empty or holds the sink.
+ */
+void ParallelBFSAlgorithm::advanceFrontier(SearchState &state)
+{
+    long long scannedArcs = 0;
+    long long nextArcs = 0;
+    for (int thread = 0; thread < state.threadCount; thread++)
+    {
+        scannedArcs += state.scannedArcCounts[thread];
+        nextArcs += state.nextArcCounts[thread];
+        state.nextArcCounts[thread] = 0;
+    }
+
+    state.frontier.clear();
+    for (int thread = 0; thread < state.threadCount; thread++)
+    {
+        state.frontier.insert(state.frontier.end(), state.nextFrontiers[thread].begin(), state.nextFrontiers[thread].end());
+        state.nextFrontiers[thread].clear();
+    }
+    state.depth++;
+
+    // Nodes beyond the level of the sink cannot lie on a shortest path to it
+    state.done = state.frontier.empty() || state.levels[state.sink] != -1;
+
+    // Bottom-up counts the arcs of the nodes it claims; top-down assumes they have the average degree, to spare a lookup per node
+    if (state.bottomUp)
+    {
+        state.bottomUpArcs = scannedArcs;
+        state.frontierArcs = nextArcs;
+    }
+    else
+    {
+        state.frontierArcs = static_cast<long long>(state.frontier.size()) * 2 * state.network.getEdgeCount() / state.network.getNodeCount();
+    }
+    state.unexploredArcs -= state.frontierArcs;
+
+    // A top-down level scans the arcs of the frontier. A bottom-up level scans the arcs of every unvisited node up to its
+    // first parent, and in a residual network many nodes have none, so it is charged with all the unexplored arcs until
+    // a bottom-up level has measured its cost.
+    long long bottomUpCost = (state.bottomUpArcs == -1) ? state.unexploredArcs : state.bottomUpArcs;
+    state.bottomUp = state.frontierArcs > bottomUpCost;
+}
+
+/*
+ * @brief Wait until every thread of the search has reached this point.
+ * @param state The shared state of the search.
+ * @pre Every thread calls it the same number of times.
+ * @post The writes of every thread before the call are visible to the caller.
+ */
+void ParallelBFSAlgorithm::waitForThreads(SearchState &state)
+{
+    if (state.threadCount == 1)
+    {
+        return;
+    }
+
+    // The last thread to arrive opens the barrier for the others
+    int generation = state.barrierGeneration.load();
+    if (state.arrivedThreads.fetch_add(1) + 1 == state.threadCount)
+    {
+        state.arrivedThreads.store(0);
+        state.barrierGeneration.fetch_add(1);
+    }
+    else
+    {
+        while (state.barrierGeneration.load() == generation)
+        {
+            this_thread::yield();
+        }
+    }
+}
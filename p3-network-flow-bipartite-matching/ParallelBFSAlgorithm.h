@@ -0,0 +1,85 @@
+/*
+ * @file ParallelBFSAlgorithm.h
+ * @brief Declaration of the ParallelBFSAlgorithm class, a multithreaded direction-optimizing breadth-first search.
+ *
+ * This file defines the ParallelBFSAlgorithm class, which labels the nodes of a residual network with their distance
+ * from the source and writes nothing but an int level array. The search runs one level at a time on several threads.
+ * While the frontier is small, each thread expands its share of the frontier top-down and collects the nodes it
+ * discovers in its own next frontier, claiming each node with an atomic update of a shared visited bitmap. Once the
+ * arcs leaving the frontier outnumber a fraction of the arcs still unexplored, the search turns bottom-up: each
+ * thread walks its own range of unvisited nodes and looks for a parent in the frontier through the reverse arcs,
+ * stopping at the first one. It turns top-down again when the frontier shrinks.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+#include "ResidualNetwork.h"
+
+/*
+ * @brief Class providing a multithreaded direction-optimizing breadth-first search over residual arcs.
+ */
+class ParallelBFSAlgorithm
+{
+public:
+    /*
+     * @brief Label every node with its BFS distance from the source over arcs with residual capacity.
+     * @param network The residual network.
+     * @param source The index of the source node.
+     * @param sink The index of the sink node.
+     * @param levels Receives the distance of each node, or -1 for nodes the search did not reach.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @return True if the sink was reached, false otherwise.
+     * @pre The network is built, and levels holds one entry per node.
+     * @post The levels are set; the search stops after the level of the sink, so nodes farther away are left unreached.
+     */
+    static bool buildLevels(const ResidualNetwork &network, int source, int sink, std::vector<int> &levels, int threadCount = 0);
+
+private:
+    struct SearchState; // The frontiers, bitmaps and counters shared by the threads of one search
+
+    /*
+     * @brief Run the levels of the search on one thread.
+     * @param state The shared state of the search.
+     * @param thread The index of the thread, from 0 to the number of threads - 1.
+     * @pre The source is labeled and forms the frontier.
+     * @post The search is finished.
+     */
+    static void searchLevels(SearchState &state, int thread);
+
+    /*
+     * @brief Expand the share of the frontier of one thread along the arcs that leave it.
+     * @param state The shared state of the search.
+     * @param thread The index of the thread.
+     * @pre The frontier holds the nodes of the current level.
+     * @post Every node reached from the share is labeled and placed in the next frontier of the thread that claimed it.
+     */
+    static void expandTopDown(SearchState &state, int thread);
+
+    /*
+     * @brief Look for a parent in the frontier for every unvisited node in the range of one thread.
+     * @param state The shared state of the search.
+     * @param thread The index of the thread.
+     * @pre The frontier bitmap marks the nodes of the current level.
+     * @post Every node of the range with a residual arc from the frontier is labeled and placed in the next frontier of the thread.
+     */
+    static void expandBottomUp(SearchState &state, int thread);
+
+    /*
+     * @brief Merge the next frontiers of all threads and choose the direction of the next level.
+     * @param state The shared state of the search.
+     * @pre Every thread has finished expanding the current level.
+     * @post The frontier holds the nodes of the next level, and the search is marked done if it is empty or holds the sink.
+     */
+    static void advanceFrontier(SearchState &state);
+
+    /*
+     * @brief Wait until every thread of the search has reached this point.
+     * @param state The shared state of the search.
+     * @pre Every thread calls it the same number of times.
+     * @post The writes of every thread before the call are visible to the caller.
+     */
+    static void waitForThreads(SearchState &state);
+};
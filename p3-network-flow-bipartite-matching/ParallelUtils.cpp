@@ -0,0 +1,34 @@
+/*
+ * @file ParallelUtils.cpp
+ * @brief Implementation of the ParallelUtils class, shared helpers for the multithreaded engines.
+ *
+ * This file contains the implementation of the ParallelUtils class.
+ *
+ * @author Phat Tran
+ */
+
+#include "ParallelUtils.h"
+#include <thread>
+
+using namespace std;
+
+/*
+ * @brief Resolve a requested worker thread count.
+ * @param threadCount The requested number of threads, or 0 to use every hardware thread.
+ * @param workItems The number of independent work items available.
+ * @return A thread count between 1 and workItems (at least 1).
+ * @pre None.
+ * @post The number of threads to start is returned.
+ */
+int ParallelUtils::resolveThreadCount(int threadCount, size_t workItems)
+{
+    if (threadCount <= 0)
+    {
+        threadCount = static_cast<int>(thread::hardware_concurrency());
+    }
+    if (static_cast<size_t>(threadCount) > workItems)
+    {
+        threadCount = static_cast<int>(workItems);
+    }
+    return (threadCount < 1) ? 1 : threadCount;
+}
@@ -0,0 +1,30 @@
+/*
+ * @file ParallelUtils.h
+ * @brief Declaration of the ParallelUtils class, shared helpers for the multithreaded engines.
+ *
+ * This file contains the declaration of the ParallelUtils class, which provides the helpers shared by
+ * the engines that split their work across std::thread workers.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/*
+ * @brief Class providing helpers for multithreaded engines.
+ */
+class ParallelUtils
+{
+public:
+    /*
+     * @brief Resolve a requested worker thread count.
+     * @param threadCount The requested number of threads, or 0 to use every hardware thread.
+     * @param workItems The number of independent work items available.
+     * @return A thread count between 1 and workItems (at least 1).
+     * @pre None.
+     * @post The number of threads to start is returned.
+     */
+    static int resolveThreadCount(int threadCount, size_t workItems);
+};
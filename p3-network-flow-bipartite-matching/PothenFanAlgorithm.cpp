@@ -0,0 +1,315 @@
+/*
+ * @file PothenFanAlgorithm.cpp
+ * @brief Implementation of the PothenFanAlgorithm class functions.
+ *
+ * This file contains the implementation of the functions declared in the PothenFanAlgorithm class. The edges are laid
+ * out as a compressed adjacency array of the left nodes, as in Hopcroft-Karp. The threads of a phase take the free
+ * left nodes in chunks from a shared atomic counter. A right node is claimed by exchanging the number of the phase into
+ * its slot, so the claims never need to be cleared. A left node other than a root is only reached through its claimed
+ * mate, so its search pointers and its entry in matchL belong to one search at a time and need no atomics; matchR is
+ * atomic because the lookahead reads it before claiming.
+ *
+ * @author Phat Tran
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include "PothenFanAlgorithm.h"
+#include "ParallelUtils.h"
+
+using namespace std;
+
+/*
+ * @brief The matching, the claims and the search pointers shared by the threads of one phase.
+ */
+struct PothenFanAlgorithm::SearchState
+{
+    SearchState(int leftCount, int rightCount)
+        : matchL(leftCount, -1), matchR(rightCount), matchedEntries(leftCount, -1), claimedPhases(rightCount),
+          lookaheadEntries(leftCount), triedEntries(leftCount) {}
+
+    vector<int> offsets;                // First adjacency entry of each left node, followed by the number of entries.
+    vector<int> adjacentNodes;          // Right node of each adjacency entry.
+    vector<int> adjacentEdges;          // Graph edge of each adjacency entry.
+    vector<int> matchL;                 // Right node matched to each left node, or -1.
+    vector<atomic<int>> matchR;         // Left node matched to each right node, or -1.
+    vector<int> matchedEntries;         // Adjacency entry matching each left node, or -1.
+    vector<atomic<int>> claimedPhases;  // Last phase in which each right node was claimed.
+    vector<int> lookaheadEntries;       // Next entry to check for a free right node, per left node, kept across phases.
+    vector<int> triedEntries;           // Number of entries each left node has searched deeper from in the phase.
+    vector<int> freeNodes;              // Free left nodes of the phase.
+    atomic<size_t> nextFreeNode{0};     // Position of the next free left node to hand out.
+    int phase = 0;                      // Number of the current phase, from 1.
+};
+
+/*
+ * @brief Find a maximum matching of a bipartite graph.
+ * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose edges lead from the left set to the right set.
+ * @param nodeCount The number of nodes in the graph, without a source or a sink.
+ * @param matching A matching over the nodes 1 to nodeCount to start from, or an empty matching over no nodes; receives the maximum matching.
+ * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+ * @return The number of matched pairs.
+ * @pre nodeCount is even.
+ * @post No augmenting path remains for the matching.
+ */
+int PothenFanAlgorithm::findMaximumMatching(const Graph &graph, int nodeCount, Matching &matching, int threadCount)
+{
+    // Short phases are not worth starting threads for; give every thread a sizable share of the free left nodes
+    const size_t ROOTS_PER_THREAD = 1024;
+
+    const vector<Edge> &edges = graph.getEdges();
+    int leftCount = nodeCount / 2;
+    int rightCount = nodeCount - leftCount;
+    SearchState state(leftCount, rightCount);
+
+    // Lay out the edges by left node, renumbering both sets from 0
+    state.offsets.assign(leftCount + 1, 0);
+    for (const Edge &edge : edges)
+    {
+        int left = edge.getSourceIndex() - 1;
+        int right = edge.getDestinationIndex() - leftCount - 1;
+        if (left < 0 || left >= leftCount || right < 0 || right >= rightCount)
+        {
+            cerr << "Error: Edge " << edge.getSourceIndex() << " -> " << edge.getDestinationIndex() << " does not lead from the left set to the right set, ignoring it." << endl;
+            continue;
+        }
+        state.offsets[left + 1]++;
+    }
+    for (int left = 0; left < leftCount; left++)
+    {
+        state.offsets[left + 1] += state.offsets[left];
+    }
+    vector<int> nextEntry(state.offsets.begin(), state.offsets.end() - 1);
+    state.adjacentNodes.resize(state.offsets[leftCount]);
+    state.adjacentEdges.resize(state.offsets[leftCount]);
+    for (int i = 0; i < static_cast<int>(edges.size()); i++)
+    {
+        int left = edges[i].getSourceIndex() - 1;
+        int right = edges[i].getDestinationIndex() - leftCount - 1;
+        if (left >= 0 && left < leftCount && right >= 0 && right < rightCount)
+        {
+            state.adjacentNodes[nextEntry[left]] = right;
+            state.adjacentEdges[nextEntry[left]++] = i;
+        }
+    }
+    for (int left = 0; left < leftCount; left++)
+    {
+        state.lookaheadEntries[left] = state.offsets[left];
+    }
+    for (int right = 0; right < rightCount; right++)
+    {
+        state.matchR[right].store(-1, memory_order_relaxed);
+        state.claimedPhases[right].store(0, memory_order_relaxed);
+    }
+
+    // Start from the given matching, then search from every free left node at once until a phase finds no augmenting path
+    int matchCount = (matching.getNodeCount() == nodeCount) ? seedMatching(matching, state) : 0;
+    while (true)
+    {
+        state.phase++;
+        state.freeNodes.clear();
+        for (int left = 0; left < leftCount; left++)
+        {
+            if (state.matchL[left] == -1 && state.offsets[left] < state.offsets[left + 1])
+            {
+                state.freeNodes.push_back(left);
+            }
+        }
+        state.nextFreeNode.store(0);
+
+        // The calling thread takes part as worker 0
+        int workerCount = ParallelUtils::resolveThreadCount(threadCount, state.freeNodes.size() / ROOTS_PER_THREAD);
+        vector<int> pathCounts(workerCount, 0);
+        vector<thread> workers;
+        for (int worker = 1; worker < workerCount; worker++)
+        {
+            workers.push_back(thread([&state, &pathCounts, worker]()
+                                     { pathCounts[worker] = searchFreeNodes(state); }));
+        }
+        pathCounts[0] = searchFreeNodes(state);
+        for (thread &worker : workers)
+        {
+            worker.join();
+        }
+
+        // A phase without an augmentation has searched every alternating path from every free left node
+        int phaseCount = 0;
+        for (int pathCount : pathCounts)
+        {
+            phaseCount += pathCount;
+        }
+        if (phaseCount == 0)
+        {
+            break;
+        }
+        matchCount += phaseCount;
+    }
+
+    // Report the matching in the node indices of the graph
+    matching = Matching(nodeCount);
+    for (int left = 0; left < leftCount; left++)
+    {
+        if (state.matchL[left] != -1)
+        {
+            matching.addPair(left + 1, state.matchL[left] + leftCount + 1, state.adjacentEdges[state.matchedEntries[left]]);
+        }
+    }
+
+    return matchCount;
+}
+
+/*
+ * @brief Copy a matching into the match arrays of the state.
+ * @param matching The matching, over the nodes of the graph.
+ * @param state The shared state, with the adjacency laid out and the match arrays empty.
+ * @return The number of pairs copied.
+ * @pre No phase has run yet.
+ * @post Every pair whose edge leads from the left set to the right set is copied.
+ */
+int PothenFanAlgorithm::seedMatching(const Matching &matching, SearchState &state)
+{
+    int pairCount = 0;
+    int leftCount = static_cast<int>(state.matchL.size());
+    for (int left = 0; left < leftCount; left++)
+    {
+        // Find the adjacency entry of the matching edge among the entries of the left node
+        int edge = matching.getMatchedEdge(left + 1);
+        for (int entry = state.offsets[left]; edge != -1 && entry < state.offsets[left + 1]; entry++)
+        {
+            if (state.adjacentEdges[entry] == edge)
+            {
+                state.matchL[left] = state.adjacentNodes[entry];
+                state.matchR[state.adjacentNodes[entry]].store(left, memory_order_relaxed);
+                state.matchedEntries[left] = entry;
+                pairCount++;
+                break;
+            }
+        }
+    }
+
+    return pairCount;
+}
+
+/*
+ * @brief Run searches from free left nodes on one thread until none are left in the phase.
+ * @param state The shared state of the phase.
+ * @return The number of augmenting paths found by the thread.
+ * @pre The free left nodes of the phase are listed in the state.
+ * @post Every search the thread started has either augmented the matching or run out of unclaimed right nodes.
+ */
+int PothenFanAlgorithm::searchFreeNodes(SearchState &state)
+{
+    // Hand out the free left nodes in chunks to keep the shared counter cold
+    const size_t CHUNK_SIZE = 64;
+
+    vector<int> pathNodes;
+    int pathCount = 0;
+    size_t freeCount = state.freeNodes.size();
+    size_t begin;
+    while ((begin = state.nextFreeNode.fetch_add(CHUNK_SIZE)) < freeCount)
+    {
+        size_t end = min(begin + CHUNK_SIZE, freeCount);
+        for (size_t i = begin; i < end; i++)
+        {
+            if (augmentFrom(state, state.freeNodes[i], pathNodes))
+            {
+                pathCount++;
+            }
+        }
+    }
+
+    return pathCount;
+}
+
+/*
+ * @brief Search for an augmenting path from one free left node and flip it.
+ * @param state The shared state of the phase.
+ * @param root The free left node.
+ * @param pathNodes Scratch space for the left nodes of the current path.
+ * @return True if the matching was augmented, false otherwise.
+ * @pre root is free.
+ * @post The right nodes the search reached are claimed for the rest of the phase.
+ */
+bool PothenFanAlgorithm::augmentFrom(SearchState &state, int root, vector<int> &pathNodes)
+{
+    // Odd phases search deeper through the entries of a left node from the front and even phases from the back, so
+    // that the searches of consecutive phases do not all take the same first turns
+    const int phase = state.phase;
+    const bool forward = (phase % 2 == 1);
+    pathNodes.clear();
+    pathNodes.push_back(root);
+    state.triedEntries[root] = 0;
+
+    while (!pathNodes.empty())
+    {
+        int left = pathNodes.back();
+        int entryEnd = state.offsets[left + 1];
+
+        // Look ahead for a free right node; a matched right node never becomes free again, so the pointer only moves forward
+        int freeEntry = -1;
+        for (int &entry = state.lookaheadEntries[left]; entry < entryEnd; entry++)
+        {
+            int right = state.adjacentNodes[entry];
+            if (state.matchR[right].load(memory_order_relaxed) == -1 && state.claimedPhases[right].load(memory_order_relaxed) != phase &&
+                state.claimedPhases[right].exchange(phase, memory_order_relaxed) != phase)
+            {
+                freeEntry = entry++;
+                break;
+            }
+        }
+
+        if (freeEntry != -1)
+        {
+            // Flip the path: every left node on it takes the right node of its current entry, and the last one the free right node
+            for (size_t i = 0; i < pathNodes.size(); i++)
+            {
+                int pathLeft = pathNodes[i];
+                int tried = state.triedEntries[pathLeft];
+                int entry = (i + 1 == pathNodes.size()) ? freeEntry
+                            : forward                   ? state.offsets[pathLeft] + tried
+                                                        : state.offsets[pathLeft + 1] - 1 - tried;
+                int right = state.adjacentNodes[entry];
+                state.matchL[pathLeft] = right;
+                state.matchR[right].store(pathLeft, memory_order_relaxed);
+                state.matchedEntries[pathLeft] = entry;
+            }
+            return true;
+        }
+
+        // Go deeper through the mate of the first right node this search can claim
+        int degree = entryEnd - state.offsets[left];
+        int &tried = state.triedEntries[left];
+        int right = -1;
+        for (; tried < degree; tried++)
+        {
+            int candidate = state.adjacentNodes[forward ? state.offsets[left] + tried : entryEnd - 1 - tried];
+            if (state.claimedPhases[candidate].load(memory_order_relaxed) != phase && state.claimedPhases[candidate].exchange(phase, memory_order_relaxed) != phase)
+            {
+                right = candidate;
+                break;
+            }
+        }
+
+        if (right != -1)
+        {
+            // The lookahead has passed every free right node, so the claimed right node is matched, and its mate is
+            // reached for the first time in the phase
+            int mate = state.matchR[right].load(memory_order_relaxed);
+            state.triedEntries[mate] = 0;
+            pathNodes.push_back(mate);
+        }
+        else
+        {
+            // Retreat: every right node of the left node is claimed
+            pathNodes.pop_back();
+            if (!pathNodes.empty())
+            {
+                state.triedEntries[pathNodes.back()]++;
+            }
+        }
+    }
+
+    return false;
+}
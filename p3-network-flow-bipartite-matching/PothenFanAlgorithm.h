@@ -0,0 +1,72 @@
+/*
+ * @file PothenFanAlgorithm.h
+ * @brief Declaration of the PothenFanAlgorithm class, a multithreaded Pothen-Fan maximum bipartite matching algorithm.
+ *
+ * This file defines the PothenFanAlgorithm class. Each phase starts a depth-first search from every free left node,
+ * with the searches spread over several threads that run at the same time. A right node belongs to the first search
+ * that claims it with an atomic exchange, and each right node is claimed at most once per phase, so the search
+ * trees are vertex-disjoint and every thread can flip its own augmenting path without a lock. Before going deeper,
+ * a search looks ahead along the edges of the current left node for a free right node, with a lookahead pointer that
+ * never moves back. Consecutive phases try the edges of a left node in opposite orders when going deeper. The phases
+ * repeat until one finds no augmenting path, which leaves a maximum matching.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+#include "Graph.h"
+#include "Matching.h"
+
+/*
+ * @brief Class providing a multithreaded Pothen-Fan maximum bipartite matching algorithm.
+ */
+class PothenFanAlgorithm
+{
+public:
+    /*
+     * @brief Find a maximum matching of a bipartite graph.
+     * @param graph The graph, whose nodes 1 to nodeCount / 2 form the left set and whose edges lead from the left set to the right set.
+     * @param nodeCount The number of nodes in the graph, without a source or a sink.
+     * @param matching A matching over the nodes 1 to nodeCount to start from, or an empty matching over no nodes; receives the maximum matching.
+     * @param threadCount The number of worker threads, or 0 to use every hardware thread.
+     * @return The number of matched pairs.
+     * @pre nodeCount is even.
+     * @post No augmenting path remains for the matching.
+     */
+    static int findMaximumMatching(const Graph &graph, int nodeCount, Matching &matching, int threadCount = 0);
+
+private:
+    struct SearchState; // The matching, the claims and the search pointers shared by the threads of one phase
+
+    /*
+     * @brief Copy a matching into the match arrays of the state.
+     * @param matching The matching, over the nodes of the graph.
+     * @param state The shared state, with the adjacency laid out and the match arrays empty.
+     * @return The number of pairs copied.
+     * @pre No phase has run yet.
+     * @post Every pair whose edge leads from the left set to the right set is copied.
+     */
+    static int seedMatching(const Matching &matching, SearchState &state);
+
+    /*
+     * @brief Run searches from free left nodes on one thread until none are left in the phase.
+     * @param state The shared state of the phase.
+     * @return The number of augmenting paths found by the thread.
+     * @pre The free left nodes of the phase are listed in the state.
+     * @post Every search the thread started has either augmented the matching or run out of unclaimed right nodes.
+     */
+    static int searchFreeNodes(SearchState &state);
+
+    /*
+     * @brief Search for an augmenting path from one free left node and flip it.
+     * @param state The shared state of the phase.
+     * @param root The free left node.
+     * @param pathNodes Scratch space for the left nodes of the current path.
+     * @return True if the matching was augmented, false otherwise.
+     * @pre root is free.
+     * @post The right nodes the search reached are claimed for the rest of the phase.
+     */
+    static bool augmentFrom(SearchState &state, int root, std::vector<int> &pathNodes);
+};
@@ -0,0 +1,198 @@
+/*
+ * @file PushRelabelAlgorithm.cpp
+ * @brief Implementation of the PushRelabelAlgorithm class functions.
+ *
+ * This file contains the implementation of the functions declared in the PushRelabelAlgorithm class. Every node
+ * keeps a current arc, so a discharge resumes where the previous one stopped, and the number of nodes at each
+ * height is counted so that a gap is noticed as soon as a relabel empties a height. A global relabel runs at the
+ * start and again after every V relabels.
+ *
+ * @author Phat Tran
+ */
+
+#include <algorithm>
+#include <deque>
+#include "PushRelabelAlgorithm.h"
+
+using namespace std;
+
+/*
+ * @brief Find a maximum flow from a source to a sink.
+ * @param network The residual network, which may already carry flow.
+ * @param source The index of the source node.
+ * @param sink The index of the sink node.
+ * @return The amount of flow added to the network.
+ * @pre The network is built, and source and sink are distinct nodes of it.
+ * @post The network carries a maximum flow from the source to the sink, with no excess left at any other node.
+ */
+long long PushRelabelAlgorithm::findMaxFlow(ResidualNetwork &network, int source, int sink)
+{
+    int nodeCount = network.getNodeCount();
+    vector<int> heights(nodeCount), heightCounts(2 * nodeCount + 1), currentArcs(nodeCount), nodeQueue(nodeCount);
+    vector<long long> excess(nodeCount, 0);
+    vector<bool> active(nodeCount, false);
+    deque<int> activeNodes;
+
+    // Saturate every arc leaving the source
+    for (int arc = network.getArcBegin(source); arc < network.getArcEnd(source); arc++)
+    {
+        int capacity = network.getCapacity(arc);
+        int head = network.getHead(arc);
+        if (capacity > 0 && head != source)
+        {
+            network.pushFlow(arc, capacity);
+            excess[head] += capacity;
+            excess[source] -= capacity;
+            if (head != sink && !active[head])
+            {
+                active[head] = true;
+                activeNodes.push_back(head);
+            }
+        }
+    }
+    globalRelabel(network, source, sink, heights, heightCounts, currentArcs, nodeQueue);
+
+    int relabelCount = 0;
+    while (!activeNodes.empty())
+    {
+        int node = activeNodes.front();
+        activeNodes.pop_front();
+        active[node] = false;
+
+        // Discharge the node: push along admissible arcs, relabel when none is left
+        while (excess[node] > 0)
+        {
+            int &arc = currentArcs[node];
+            if (arc == network.getArcEnd(node))
+            {
+                // Relabel to one above the lowest neighbor still reachable through a residual arc
+                int oldHeight = heights[node];
+                int newHeight = 2 * nodeCount;
+                for (int candidate = network.getArcBegin(node); candidate < network.getArcEnd(node); candidate++)
+                {
+                    if (network.getCapacity(candidate) > 0)
+                    {
+                        newHeight = min(newHeight, heights[network.getHead(candidate)] + 1);
+                    }
+                }
+                heightCounts[oldHeight]--;
+
+                // Gap: no node is left at the old height, so nothing above it can reach the sink
+                if (heightCounts[oldHeight] == 0 && oldHeight < nodeCount)
+                {
+                    for (int other = 0; other < nodeCount; other++)
+                    {
+                        if (heights[other] > oldHeight && heights[other] < nodeCount)
+                        {
+                            heightCounts[heights[other]]--;
+                            heights[other] = nodeCount + 1;
+                            heightCounts[heights[other]]++;
+                            currentArcs[other] = network.getArcBegin(other);
+                        }
+                    }
+                    newHeight = max(newHeight, nodeCount + 1);
+                }
+
+                heights[node] = min(newHeight, 2 * nodeCount);
+                heightCounts[heights[node]]++;
+                arc = network.getArcBegin(node);
+                relabelCount++;
+                continue;
+            }
+
+            int head = network.getHead(arc);
+            if (network.getCapacity(arc) > 0 && heights[node] == heights[head] + 1)
+            {
+                // Push as much of the excess as the arc can take
+                int amount = static_cast<int>(min(excess[node], static_cast<long long>(network.getCapacity(arc))));
+                network.pushFlow(arc, amount);
+                excess[node] -= amount;
+                excess[head] += amount;
+                if (head != source && head != sink && !active[head])
+                {
+                    active[head] = true;
+                    activeNodes.push_back(head);
+                }
+            }
+            else
+            {
+                arc++;
+            }
+        }
+
+        // Refresh the heights once the relabels have done about as much work as a global relabel
+        if (relabelCount >= nodeCount)
+        {
+            globalRelabel(network, source, sink, heights, heightCounts, currentArcs, nodeQueue);
+            relabelCount = 0;
+        }
+    }
+
+    return excess[sink];
+}
+
+/*
+ * @brief Recompute every height as the BFS distance over residual arcs to the sink, or to the source for nodes that cannot reach the sink.
+ * @param network The residual network.
+ * @param source The index of the source node.
+ * @param sink The index of the sink node.
+ * @param heights Receives the height of each node: the distance to the sink, or the node count plus the distance to the source.
+ * @param heightCounts Receives the number of nodes at each height.
+ * @param currentArcs Reset to the first arc of each node.
+ * @param nodeQueue Scratch space for the BFS queue.
+ * @pre None.
+ * @post The heights are valid: no residual arc leads from a node to one more than one height below it.
+ */
+void PushRelabelAlgorithm::globalRelabel(const ResidualNetwork &network, int source, int sink, vector<int> &heights,
+                                         vector<int> &heightCounts, vector<int> &currentArcs, vector<int> &nodeQueue)
+{
+    int nodeCount = network.getNodeCount();
+    fill(heights.begin(), heights.end(), -1);
+
+    // The source stays at the node count; everything else is measured from the sink first
+    heights[source] = nodeCount;
+    heights[sink] = 0;
+    labelBackward(network, sink, heights, nodeQueue);
+    labelBackward(network, source, heights, nodeQueue);
+
+    // Nodes that reach neither hold no excess and are never relabeled
+    fill(heightCounts.begin(), heightCounts.end(), 0);
+    for (int node = 0; node < nodeCount; node++)
+    {
+        if (heights[node] == -1)
+        {
+            heights[node] = 2 * nodeCount;
+        }
+        heightCounts[heights[node]]++;
+        currentArcs[node] = network.getArcBegin(node);
+    }
+}
+
+/*
+ * @brief Label the nodes reached by a backward BFS over residual arcs.
+ * @param network The residual network.
+ * @param root The node the search starts from.
+ * @param heights The heights; unlabeled nodes hold -1, and each node the search reaches receives the height of the root plus its distance.
+ * @param nodeQueue Scratch space for the BFS queue.
+ * @pre heights[root] is set.
+ * @post Every unlabeled node that can reach the root through residual arcs of unlabeled nodes has a height.
+ */
+void PushRelabelAlgorithm::labelBackward(const ResidualNetwork &network, int root, vector<int> &heights, vector<int> &nodeQueue)
+{
+    nodeQueue[0] = root;
+    int queueEnd = 1;
+    for (int queueHead = 0; queueHead < queueEnd; queueHead++)
+    {
+        int node = nodeQueue[queueHead];
+        for (int arc = network.getArcBegin(node); arc < network.getArcEnd(node); arc++)
+        {
+            // The partner of an arc leaving the node is an arc entering it
+            int tail = network.getHead(arc);
+            if (heights[tail] == -1 && network.getCapacity(network.getReverseArc(arc)) > 0)
+            {
+                heights[tail] = heights[node] + 1;
+                nodeQueue[queueEnd++] = tail;
+            }
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * @file PushRelabelAlgorithm.h
+ * @brief Declaration of the PushRelabelAlgorithm class, the FIFO push-relabel maximum flow algorithm.
+ *
+ * This file defines the PushRelabelAlgorithm class. Instead of looking for whole augmenting paths, push-relabel
+ * floods the network from the source and lets each node with excess flow push it to neighbors that are one height
+ * lower, raising its own height when it cannot. Active nodes are processed in FIFO order. Two heuristics keep the
+ * heights close to the true distances to the sink: a periodic global relabel recomputes them by a backward BFS,
+ * and the gap heuristic lifts every node above a height that no node holds any more, since none of them can reach
+ * the sink. The algorithm runs in O(V^3) time and is usually much faster on dense, layered capacity graphs.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+#include "ResidualNetwork.h"
+
+/*
+ * @brief Class providing the FIFO push-relabel maximum flow algorithm.
+ */
+class PushRelabelAlgorithm
+{
+public:
+    /*
+     * @brief Find a maximum flow from a source to a sink.
+     * @param network The residual network, which may already carry flow.
+     * @param source The index of the source node.
+     * @param sink The index of the sink node.
+     * @return The amount of flow added to the network.
+     * @pre The network is built, and source and sink are distinct nodes of it.
+     * @post The network carries a maximum flow from the source to the sink, with no excess left at any other node.
+     */
+    static long long findMaxFlow(ResidualNetwork &network, int source, int sink);
+
+private:
+    /*
+     * @brief Recompute every height as the BFS distance over residual arcs to the sink, or to the source for nodes that cannot reach the sink.
+     * @param network The residual network.
+     * @param source The index of the source node.
+     * @param sink The index of the sink node.
+     * @param heights Receives the height of each node: the distance to the sink, or the node count plus the distance to the source.
+     * @param heightCounts Receives the number of nodes at each height.
+     * @param currentArcs Reset to the first arc of each node.
+     * @param nodeQueue Scratch space for the BFS queue.
+     * @pre None.
+     * @post The heights are valid: no residual arc leads from a node to one more than one height below it.
+     */
+    static void globalRelabel(const ResidualNetwork &network, int source, int sink, std::vector<int> &heights,
+                              std::vector<int> &heightCounts, std::vector<int> &currentArcs, std::vector<int> &nodeQueue);
+
+    /*
+     * @brief Label the nodes reached by a backward BFS over residual arcs.
+     * @param network The residual network.
+     * @param root The node the search starts from.
+     * @param heights The heights; unlabeled nodes hold -1, and each node the search reaches receives the height of the root plus its distance.
+     * @param nodeQueue Scratch space for the BFS queue.
+     * @pre heights[root] is set.
+     * @post Every unlabeled node that can reach the root through residual arcs of unlabeled nodes has a height.
+     */
+    static void labelBackward(const ResidualNetwork &network, int root, std::vector<int> &heights, std::vector<int> &nodeQueue);
+};
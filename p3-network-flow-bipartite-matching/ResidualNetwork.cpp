@@ -0,0 +1,138 @@
+/*
+ * @file ResidualNetwork.cpp
+ * @brief Implementation of the ResidualNetwork class functions.
+ *
+ * This file contains the implementation of the functions declared in the ResidualNetwork class. The network is
+ * laid out with a counting sort on the node each arc leaves: one pass counts the arcs of every node, a prefix sum
+ * turns the counts into offsets, and a second pass places each forward arc and its reverse arc and links them.
+ *
+ * @author Phat Tran
+ */
+
+#include <iostream>
+#include "ResidualNetwork.h"
+
+using namespace std;
+
+/*
+ * @brief Constructor for ResidualNetwork class.
+ * @param nodeCount The number of nodes, indexed from 0, optional with a default of 0.
+ * @pre nodeCount >= 0.
+ * @post An empty ResidualNetwork object with the given number of nodes is created.
+ */
+ResidualNetwork::ResidualNetwork(int nodeCount) : nodeCount(nodeCount), offsets(nodeCount + 1, 0) {}
+
+/*
+ * @brief Destructor for ResidualNetwork class.
+ * @pre None.
+ * @post The ResidualNetwork object and its associated resources are deallocated.
+ */
+ResidualNetwork::~ResidualNetwork() {}
+
+/*
+ * @brief Add an edge, which becomes a forward arc and its reverse arc once the network is built.
+ * @param tail The index of the node the edge leaves.
+ * @param head The index of the node the edge enters.
+ * @param capacity The capacity of the edge.
+ * @param cost The cost of one unit of flow on the edge, optional with a default of 0.
+ * @return The identifier of the edge, counting from 0 in the order of insertion, or -1 if a node index is out of range.
+ * @pre The network has not been built yet.
+ * @post The edge is recorded.
+ */
+int ResidualNetwork::addEdge(int tail, int head, int capacity, int cost)
+{
+    // Check if the endpoints are out of range
+    if (tail < 0 || tail >= this->nodeCount || head < 0 || head >= this->nodeCount)
+    {
+        cerr << "Error: Edge " << tail << " -> " << head << " is out of range, ignoring it." << endl;
+        return -1;
+    }
+
+    this->edgeTails.push_back(tail);
+    this->edgeHeads.push_back(head);
+    this->edgeCapacities.push_back(capacity);
+    this->edgeCosts.push_back(cost);
+    return static_cast<int>(this->edgeTails.size()) - 1;
+}
+
+/*
+ * @brief Lay out the recorded edges as arcs grouped by the node they leave.
+ * @pre None.
+ * @post The arcs of each node occupy a contiguous range, in the order their edges were added, and the recorded edges are released.
+ */
+void ResidualNetwork::build()
+{
+    int edgeCount = static_cast<int>(this->edgeTails.size());
+    int arcCount = 2 * edgeCount;
+
+    // Count the arcs leaving each node: the forward arc at the tail, the reverse arc at the head
+    this->offsets.assign(this->nodeCount + 1, 0);
+    for (int i = 0; i < edgeCount; i++)
+    {
+        this->offsets[this->edgeTails[i] + 1]++;
+        this->offsets[this->edgeHeads[i] + 1]++;
+    }
+    for (int node = 0; node < this->nodeCount; node++)
+    {
+        this->offsets[node + 1] += this->offsets[node];
+    }
+
+    // Place each pair of arcs at the next free slot of its node and link the two
+    vector<int> nextArc(this->offsets.begin(), this->offsets.end() - 1);
+    this->heads.assign(arcCount, 0);
+    this->capacities.assign(arcCount, 0);
+    this->costs.assign(arcCount, 0);
+    this->reverseArcs.assign(arcCount, 0);
+    this->edgeArcs.assign(edgeCount, 0);
+    this->arcEdges.assign(arcCount, 0);
+    for (int i = 0; i < edgeCount; i++)
+    {
+        int forwardArc = nextArc[this->edgeTails[i]]++;
+        int reverseArc = nextArc[this->edgeHeads[i]]++;
+        this->heads[forwardArc] = this->edgeHeads[i];
+        this->heads[reverseArc] = this->edgeTails[i];
+        this->capacities[forwardArc] = this->edgeCapacities[i];
+        this->costs[forwardArc] = this->edgeCosts[i];
+        this->costs[reverseArc] = -this->edgeCosts[i];
+        this->reverseArcs[forwardArc] = reverseArc;
+        this->reverseArcs[reverseArc] = forwardArc;
+        this->edgeArcs[i] = forwardArc;
+        this->arcEdges[forwardArc] = i;
+        this->arcEdges[reverseArc] = i;
+    }
+
+    // The recorded edges are no longer needed
+    vector<int>().swap(this->edgeTails);
+    vector<int>().swap(this->edgeHeads);
+    vector<int>().swap(this->edgeCapacities);
+    vector<int>().swap(this->edgeCosts);
+}
+
+/*
+ * @brief Get the number of nodes.
+ * @return The number of nodes.
+ * @pre None.
+ * @post None.
+ */
+int ResidualNetwork::getNodeCount() const { return this->nodeCount; }
+
+/*
+ * @brief Get the number of edges.
+ * @return The number of edges; the network holds twice as many arcs.
+ * @pre None.
+ * @post None.
+ */
+int ResidualNetwork::getEdgeCount() const { return static_cast<int>(this->edgeArcs.size()); }
+
+/*
+ * @brief Get the flow on an edge.
+ * @param edge The identifier of the edge.
+ * @return The flow currently carried by the edge.
+ * @pre The network is built.
+ * @post None.
+ */
+int ResidualNetwork::getFlow(int edge) const
+{
+    // The reverse arc starts empty, so its residual capacity is the flow pushed so far
+    return this->capacities[this->reverseArcs[this->edgeArcs[edge]]];
+}
@@ -0,0 +1,190 @@
+/*
+ * @file ResidualNetwork.h
+ * @brief Declaration of the ResidualNetwork class, a residual graph stored in compressed sparse row form.
+ *
+ * This file defines the ResidualNetwork class. Edges are first collected, then laid out in one pass so that the
+ * arcs leaving each node occupy a contiguous range of a few flat arrays. Every edge becomes a forward arc that
+ * holds its capacity and cost and a reverse arc that starts empty with the negated cost, and each arc stores the
+ * index of its partner and a handle to its edge.
+ * Pushing flow along an arc therefore only moves capacity between the two arcs, in place.
+ *
+ * @author Phat Tran
+ */
+
+#pragma once
+
+#include <vector>
+
+/*
+ * @brief Class representing a residual graph in compressed sparse row form.
+ */
+class ResidualNetwork
+{
+public:
+    /*
+     * @brief Constructor for ResidualNetwork class.
+     * @param nodeCount The number of nodes, indexed from 0, optional with a default of 0.
+     * @pre nodeCount >= 0.
+     * @post An empty ResidualNetwork object with the given number of nodes is created.
+     */
+    explicit ResidualNetwork(int nodeCount = 0);
+
+    /*
+     * @brief Destructor for ResidualNetwork class.
+     * @pre None.
+     * @post The ResidualNetwork object and its associated resources are deallocated.
+     */
+    ~ResidualNetwork();
+
+    /*
+     * @brief Add an edge, which becomes a forward arc and its reverse arc once the network is built.
+     * @param tail The index of the node the edge leaves.
+     * @param head The index of the node the edge enters.
+     * @param capacity The capacity of the edge.
+     * @param cost The cost of one unit of flow on the edge, optional with a default of 0.
+     * @return The identifier of the edge, counting from 0 in the order of insertion, or -1 if a node index is out of range.
+     * @pre The network has not been built yet.
+     * @post The edge is recorded.
+     */
+    int addEdge(int tail, int head, int capacity, int cost = 0);
+
+    /*
+     * @brief Lay out the recorded edges as arcs grouped by the node they leave.
+     * @pre None.
+     * @post The arcs of each node occupy a contiguous range, in the order their edges were added, and the recorded edges are released.
+     */
+    void build();
+
+    /*
+     * @brief Get the number of nodes.
+     * @return The number of nodes.
+     * @pre None.
+     * @post None.
+     */
+    int getNodeCount() const;
+
+    /*
+     * @brief Get the number of edges.
+     * @return The number of edges; the network holds twice as many arcs.
+     * @pre None.
+     * @post None.
+     */
+    int getEdgeCount() const;
+
+    /*
+     * @brief Get the first arc leaving a node.
+     * @param node The index of the node.
+     * @return The index of the first arc leaving the node.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getArcBegin(int node) const { return this->offsets[node]; }
+
+    /*
+     * @brief Get the end of the arcs leaving a node.
+     * @param node The index of the node.
+     * @return One past the index of the last arc leaving the node.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getArcEnd(int node) const { return this->offsets[node + 1]; }
+
+    /*
+     * @brief Get the node an arc enters.
+     * @param arc The index of the arc.
+     * @return The index of the node.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getHead(int arc) const { return this->heads[arc]; }
+
+    /*
+     * @brief Get the residual capacity of an arc.
+     * @param arc The index of the arc.
+     * @return The amount of flow that can still be pushed along the arc.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getCapacity(int arc) const { return this->capacities[arc]; }
+
+    /*
+     * @brief Get the cost of an arc.
+     * @param arc The index of the arc.
+     * @return The cost of one unit of flow along the arc; a reverse arc refunds the cost of its edge.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getCost(int arc) const { return this->costs[arc]; }
+
+    /*
+     * @brief Get the partner of an arc.
+     * @param arc The index of the arc.
+     * @return The index of the arc in the opposite direction.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getReverseArc(int arc) const { return this->reverseArcs[arc]; }
+
+    /*
+     * @brief Get the forward arc of an edge.
+     * @param edge The identifier of the edge.
+     * @return The index of the arc that carries the flow of the edge.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getEdgeArc(int edge) const { return this->edgeArcs[edge]; }
+
+    /*
+     * @brief Get the edge an arc belongs to.
+     * @param arc The index of the arc.
+     * @return The identifier of the edge whose forward or reverse arc this is.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getArcEdge(int arc) const { return this->arcEdges[arc]; }
+
+    /*
+     * @brief Check whether an arc is the forward arc of its edge.
+     * @param arc The index of the arc.
+     * @return True if pushing flow along the arc adds flow to its edge, false if it cancels flow.
+     * @pre The network is built.
+     * @post None.
+     */
+    bool isForwardArc(int arc) const { return this->edgeArcs[this->arcEdges[arc]] == arc; }
+
+    /*
+     * @brief Push flow along an arc.
+     * @param arc The index of the arc.
+     * @param amount The amount of flow to push.
+     * @pre The network is built and amount does not exceed the residual capacity of the arc.
+     * @post The residual capacity of the arc drops by amount and that of its partner grows by amount.
+     */
+    void pushFlow(int arc, int amount)
+    {
+        this->capacities[arc] -= amount;
+        this->capacities[this->reverseArcs[arc]] += amount;
+    }
+
+    /*
+     * @brief Get the flow on an edge.
+     * @param edge The identifier of the edge.
+     * @return The flow currently carried by the edge.
+     * @pre The network is built.
+     * @post None.
+     */
+    int getFlow(int edge) const;
+
+private:
+    int nodeCount;                   // Number of nodes.
+    std::vector<int> edgeTails;      // Node each recorded edge leaves, until the network is built.
+    std::vector<int> edgeHeads;      // Node each recorded edge enters, until the network is built.
+    std::vector<int> edgeCapacities; // Capacity of each recorded edge, until the network is built.
+    std::vector<int> edgeCosts;      // Cost of each recorded edge, until the network is built.
+    std::vector<int> offsets;        // First arc of each node, followed by the total number of arcs.
+    std::vector<int> heads;          // Node each arc enters.
+    std::vector<int> capacities;     // Residual capacity of each arc.
+    std::vector<int> costs;          // Cost of each arc.
+    std::vector<int> reverseArcs;    // Partner of each arc.
+    std::vector<int> edgeArcs;       // Forward arc of each edge.
+    std::vector<int> arcEdges;       // Edge of each arc.
+};